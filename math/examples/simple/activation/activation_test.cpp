@@ -0,0 +1,163 @@
+//  ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+
+#include "math/examples/test_utils.hpp"
+#include "math/examples/simple/configs.hpp"
+#include "math/include/hls_activation.hpp"
+
+#define THRESHOLD 1
+#define SOFTMAX_N 16
+using namespace hls::math;
+
+/* Wrappers */
+ap_fixpt<S_W, S_IW> sigmoid_S_wrapper(ap_fixpt<S_W, S_IW> x){
+#pragma HLS function pipeline top
+  return sigmoid<S_W, S_IW>(x);
+}
+
+ap_fixpt<S_W, S_IW> tanh_S_wrapper(ap_fixpt<S_W, S_IW> x){
+#pragma HLS function pipeline top
+  return tanh<S_W, S_IW>(x);
+}
+
+ap_fixpt<S_W, S_IW> gelu_S_wrapper(ap_fixpt<S_W, S_IW> x){
+#pragma HLS function pipeline top
+  return gelu<S_W, S_IW>(x);
+}
+
+void softmax_S_wrapper(ap_fixpt<S_W, S_IW> in[SOFTMAX_N], ap_ufixpt<S_W, 1> out[SOFTMAX_N]){
+#pragma HLS function top
+  softmax<SOFTMAX_N>(in, out);
+}
+
+int test(const char *name, double (*cmath)(double),
+         ap_fixpt<S_W, S_IW> (*fn)(ap_fixpt<S_W, S_IW>),
+         double start_at, double limit, double delta, int graph = 0, int report = 0){
+  double max_diff = 0, avg_diff = 0;
+  int count = 0;
+  std::string test_name = find_test_name(name, S_W, S_IW, start_at, limit);
+
+  FILE* fp = fopen(test_name.c_str(), "w");
+  if (graph) fprintf(fp, "# PLOT ");
+  if (report) fprintf(fp, "# REPORT ");
+  fprintf(fp, "\n# from %f to %f at intervals of %f, using W: %d, IW: %d\n", start_at, limit, delta, S_W, S_IW);
+  fprintf(fp, "# x,expected,%s,%s diff\t\n", name, name);
+
+  printf("%s: from %f to %f at intervals of %f, using W: %d, IW: %d\n", name, start_at, limit, delta, S_W, S_IW);
+
+  for (double x = start_at; x <= limit; x += delta) {
+    ap_fixpt<S_W, S_IW> x_fixpt = x;
+    double expect = cmath((double)x_fixpt);
+    double actual = (double)fn(x_fixpt);
+
+    double diff = fabs(expect - actual);
+    if (diff > max_diff)
+      max_diff = diff;
+    avg_diff += diff;
+    count++;
+
+    fprintf(fp, "%f,%lf,%lf,%lf\n", x, expect, actual, diff);
+  }
+  avg_diff /= count;
+
+  fprintf(fp, "# %s: Count: %d\tMax error: %lf\tAvg error: %lf\n", name, count, max_diff, avg_diff);
+  printf("%s: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", name, count, max_diff, avg_diff);
+
+  fclose(fp);
+  if (avg_diff > THRESHOLD) return 1;
+  return 0;
+}
+
+// Runs softmax on n_vectors random vectors with values in [-range, range).
+int test_softmax(int n_vectors, double range){
+  double max_diff = 0, avg_diff = 0;
+  int count = 0;
+  srand(0);
+
+  printf("softmax: %d vectors of %d values in [%f, %f), using W: %d, IW: %d\n",
+         n_vectors, SOFTMAX_N, -range, range, S_W, S_IW);
+
+  for (int v = 0; v < n_vectors; v++) {
+    ap_fixpt<S_W, S_IW> in[SOFTMAX_N];
+    ap_ufixpt<S_W, 1> out[SOFTMAX_N];
+    double expect[SOFTMAX_N], max = -1e9, sum = 0;
+
+    for (int i = 0; i < SOFTMAX_N; i++) {
+      in[i] = range * (2.0 * rand() / RAND_MAX - 1);
+      if ((double)in[i] > max)
+        max = (double)in[i];
+    }
+    for (int i = 0; i < SOFTMAX_N; i++) {
+      expect[i] = exp((double)in[i] - max);
+      sum += expect[i];
+    }
+
+    softmax_S_wrapper(in, out);
+
+    for (int i = 0; i < SOFTMAX_N; i++) {
+      double diff = fabs(expect[i] / sum - (double)out[i]);
+      if (diff > max_diff)
+        max_diff = diff;
+      avg_diff += diff;
+      count++;
+    }
+  }
+  avg_diff /= count;
+
+  printf("softmax: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", count, max_diff, avg_diff);
+  if (avg_diff > THRESHOLD) return 1;
+  return 0;
+}
+
+double sigmoid_cmath(double x) { return 1 / (1 + exp(-x)); }
+double tanh_cmath(double x) { return tanh(x); }
+double gelu_cmath(double x) { return 0.5 * x * (1 + erf(x / sqrt(2.0))); }
+
+int main() {
+  int RC = 0;
+  create_dir("sigmoid_reports");
+  create_dir("tanh_reports");
+  create_dir("gelu_reports");
+
+#ifdef COSIM_EARLY_EXIT
+  // ---------------------------------------------------------------------
+  // This test will be used automatically when running cosimulation, as
+  // SmartHLS defines COSIM_EARLY_EXIT when running cosim.
+  // This test is quick, good to validate the generated verilog and see
+  // the wave form
+  // ---------------------------------------------------------------------
+  RC |= test("sigmoid", sigmoid_cmath, sigmoid_S_wrapper, -20, 20, 1, 1, 1);
+
+#else
+  // ---------------------------------------------------------------------
+  // These tests are for software run as they call the HLS module
+  // thousands of times. Good to validate the algorithm and its parameters.
+  // ---------------------------------------------------------------------
+  RC |= test("sigmoid", sigmoid_cmath, sigmoid_S_wrapper, -20, 20, 0.0001, 1, 1);
+  RC |= test("tanh", tanh_cmath, tanh_S_wrapper, -10, 10, 0.0001, 1, 1);
+  RC |= test("gelu", gelu_cmath, gelu_S_wrapper, -10, 10, 0.0001, 1, 1);
+  RC |= test_softmax(1000, 8);
+
+#endif
+
+  if (RC != 0)  printf("Errors may have occurred. Please double-check usage.\n");
+  return RC;
+}
@@ -46,6 +46,16 @@ ap_fixpt<M_W, M_IW> exp_cordic_M_wrapper(ap_fixpt<M_W, M_IW>x){
   return exp_cordic<M_W, M_IW, M_N_ITER>(x);
 }
 
+ap_fixpt<S_W, S_IW> exp_lut_S_wrapper(ap_fixpt<S_W, S_IW>x){
+#pragma HLS function pipeline top
+  return exp_lut<S_W, S_IW>(x);
+}
+
+ap_fixpt<M_W, M_IW> exp_lut_M_wrapper(ap_fixpt<M_W, M_IW>x){
+#pragma HLS function pipeline top
+  return exp_lut<M_W, M_IW>(x);
+}
+
 double exp_cmath_wrapper(double x){
 #pragma HLS function pipeline top
   return exp(x);
@@ -55,6 +65,7 @@ double exp_cmath_wrapper(double x){
 int test(double start_at, double limit, double delta, unsigned int W, int IW, int N_ITER = -1, int graph = 0, int report = 0) {
   double max_diff_taylor = 0, avg_diff_taylor = 0;
   double max_diff_cordic = 0, avg_diff_cordic = 0;
+  double max_diff_lut = 0, avg_diff_lut = 0;
   int count = 0;
   std::string test_name = find_test_name("exp", W, IW, start_at, limit, N_ITER);
 
@@ -62,29 +73,32 @@ int test(double start_at, double limit, double delta, unsigned int W, int IW, in
   if (graph) fprintf(fp, "# PLOT ");
   if (report) fprintf(fp, "# REPORT ");
   fprintf(fp, "\n# from %f to %f at intervals of %f, using W: %d, IW: %d\n", start_at, limit, delta, W, IW);
-  fprintf(fp, "# x,expected,exp_taylor,exp_taylor_diff\n");
+  fprintf(fp, "# x,expected,exp_taylor,exp_cordic,exp_lut,exp_taylor_diff,exp_cordic_diff,exp_lut_diff\n");
   printf("From %f to %f at intervals of %f, using W: %d, IW: %d\n", start_at, limit, delta, W, IW);
 
   for (double x = start_at; x <= limit; x += delta) {
     ap_fixpt<S_W, S_IW> x_fixpt = x;
 
     double expect = exp_cmath_wrapper(x);
-    double actual_taylor, diff_taylor, actual_cordic, diff_cordic;
+    double actual_taylor, diff_taylor, actual_cordic, diff_cordic, actual_lut, diff_lut;
 
     if (W == S_W && IW == S_IW){
       ap_fixpt<S_W, S_IW> x_fixpt = x;
       actual_taylor = (double)exp_taylor_S_wrapper(x_fixpt);
       actual_cordic = (double)exp_cordic_S_wrapper(x_fixpt);
+      actual_lut = (double)exp_lut_S_wrapper(x_fixpt);
     }
     else if (W == M_W && IW == M_IW){
       ap_fixpt<M_W, M_IW> x_fixpt = x;	    
       actual_taylor = (double)exp_taylor_M_wrapper(x_fixpt);
       actual_cordic = (double)exp_cordic_M_wrapper(x_fixpt);
+      actual_lut = (double)exp_lut_M_wrapper(x_fixpt);
     }
     else{ printf("Please write a custom wapper function for this bitwidth.\n"); return 1;}
 
     diff_taylor = fabs(expect - actual_taylor);
     diff_cordic = fabs(expect - actual_cordic);
+    diff_lut = fabs(expect - actual_lut);
 
     if (diff_cordic > max_diff_cordic)
       max_diff_cordic = diff_cordic;
@@ -93,21 +107,28 @@ int test(double start_at, double limit, double delta, unsigned int W, int IW, in
     if (diff_taylor > max_diff_taylor)
       max_diff_taylor = diff_taylor;
     avg_diff_taylor += diff_taylor;
+
+    if (diff_lut > max_diff_lut)
+      max_diff_lut = diff_lut;
+    avg_diff_lut += diff_lut;
     count++;
 
-    fprintf(fp, "%f,%lf,%lf,%lf,%lf,%lf\n", x, expect, actual_taylor, actual_cordic, diff_taylor, diff_cordic); 
+    fprintf(fp, "%f,%lf,%lf,%lf,%lf,%lf,%lf,%lf\n", x, expect, actual_taylor, actual_cordic, actual_lut, diff_taylor, diff_cordic, diff_lut);
   }
   
   avg_diff_taylor /= count;
   avg_diff_cordic /= count;
+  avg_diff_lut /= count;
 
     fprintf(fp, "# exp_cmath: Count: %d\tMax error: 0.000000\tAvg error: 0.000000\n", count);
     fprintf(fp, "# exp_taylor: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff_taylor, avg_diff_taylor);
     fprintf(fp, "# exp_cordic: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff_cordic, avg_diff_cordic);
+    fprintf(fp, "# exp_lut: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff_lut, avg_diff_lut);
   
     printf("exp_cmath: Count: %d\tMax error: 0.000000\tAvg error: 0.000000\n", count);
     printf("exp_taylor: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff_taylor, avg_diff_taylor);
-    printf("exp_cordic: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", count, max_diff_cordic, avg_diff_cordic);
+    printf("exp_cordic: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff_cordic, avg_diff_cordic);
+    printf("exp_lut: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", count, max_diff_lut, avg_diff_lut);
 
     fclose(fp);
 //  if (avg_diff_cordic > THRESHOLD || avg_diff_taylor > THRESHOLD) return 1;
@@ -105,6 +105,35 @@ int test(double start_at, double limit, double delta, double base, unsigned int
   return 0;
 }
 
+// Passes one error_status through a loop of log calls. Its flags are sticky
+// and count is the number of failed calls, until clear() resets them.
+int test_error_status() {
+  int RC = 0;
+  ap_ufixpt<M_W, M_IW> x[5] = {8, 0, 2, 4, 0};
+  ap_ufixpt<M_W, M_IW> b[5] = {2, 2, 0, 2, 2};
+
+  error_status status;
+  for (int i = 0; i < 5; i++)
+    log<M_W, M_IW>(x[i], b[i], status);
+  printf("error_status: count: %u\tinf: %d\tnan: %d\n", status.count, status.inf, status.nan);
+  // log(0) is -inf twice and base 0 is invalid once.
+  if (status.count != 3 || !status.inf || !status.nan || status.ok()) RC = 1;
+
+  status.clear();
+  if (status.count != 0 || status.inf || status.nan || !status.ok()) RC = 1;
+
+  // Without an error argument nothing is reported, and the result is the
+  // same as with one.
+  int error = DEFAULT_ERROR;
+  ap_fixpt<M_W, M_IW> with_error = log<M_W, M_IW>(x[1], b[1], error);
+  ap_fixpt<M_W, M_IW> without_error = log<M_W, M_IW>(x[1], b[1]);
+  if (error != INF_ERROR || with_error != without_error) RC = 1;
+  if (DEFAULT_ERROR != 0 || NAN_ERROR != 1 || INF_ERROR != 2) RC = 1;
+  if (status.count != 0) RC = 1;
+
+  printf("error_status: %s\n\n", RC ? "FAIL" : "PASS");
+  return RC;
+}
 
 int main() {
   double start;
@@ -120,6 +149,7 @@ int main() {
   test(-1, -1, 1, 3, S_W, S_IW);
   test(1, 1, 1, -3, S_W, S_IW);
   test(1, 1, 1, 0, S_W, S_IW);
+  RC |= test_error_status();
 
   // Small Test
   start = 0.01; limit = 1;  delta = 0.01; base = 2;
@@ -0,0 +1,168 @@
+//  ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+
+#include "math/examples/test_utils.hpp"
+#include "math/examples/simple/configs.hpp"
+#include "math/include/hls_matrix.hpp"
+
+#define THRESHOLD 1
+#define GEMM_M 8
+#define GEMM_N 8
+#define GEMM_K 16
+using namespace hls::math;
+
+typedef ap_fixpt<XS_W, XS_IW> elem_t;
+typedef ap_fixpt<M_W, M_IW> out_t;
+
+/* Wrappers */
+vec<out_t, 3> matvec_3x3_wrapper(matrix<elem_t, 3, 3> A, vec<elem_t, 3> x){
+#pragma HLS function pipeline top
+#pragma HLS memory partition argument(A) type(struct_fields)
+#pragma HLS memory partition argument(x) type(struct_fields)
+  return matvec<M_W, M_IW>(A, x);
+}
+
+void gemm_systolic_wrapper(hls::FIFO<vec<elem_t, GEMM_M>> &a_cols,
+                           hls::FIFO<vec<elem_t, GEMM_N>> &b_rows,
+                           hls::FIFO<vec<out_t, GEMM_N>> &c_rows){
+#pragma HLS function top
+  gemm_systolic<M_W, M_IW, GEMM_M, GEMM_N, GEMM_K>(a_cols, b_rows, c_rows);
+}
+
+static double rand_in(double range) { return range * (2.0 * rand() / RAND_MAX - 1); }
+
+// Runs the 3x3 matvec on n random matrices and vectors.
+int test_matvec(int n, double range){
+  double max_diff = 0, avg_diff = 0;
+  int count = 0;
+  srand(0);
+
+  printf("matvec 3x3: %d products with values in [%f, %f), using W: %d, IW: %d\n",
+         n, -range, range, M_W, M_IW);
+
+  for (int t = 0; t < n; t++) {
+    matrix<elem_t, 3, 3> A;
+    vec<elem_t, 3> x;
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 3; j++)
+        A(i, j) = rand_in(range);
+      x[i] = rand_in(range);
+    }
+
+    vec<out_t, 3> y = matvec_3x3_wrapper(A, x);
+
+    for (int i = 0; i < 3; i++) {
+      double expect = 0;
+      for (int j = 0; j < 3; j++)
+        expect += (double)A(i, j) * (double)x[j];
+      double diff = fabs(expect - (double)y[i]);
+      if (diff > max_diff)
+        max_diff = diff;
+      avg_diff += diff;
+      count++;
+    }
+  }
+  avg_diff /= count;
+
+  printf("matvec 3x3: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", count, max_diff, avg_diff);
+  if (avg_diff > THRESHOLD) return 1;
+  return 0;
+}
+
+// Runs the systolic GEMM on n random matrices and compares with matmul and a
+// double precision reference.
+int test_gemm(int n, double range){
+  double max_diff = 0, avg_diff = 0;
+  int count = 0;
+  srand(1);
+
+  printf("gemm_systolic %dx%dx%d: %d products with values in [%f, %f), using W: %d, IW: %d\n",
+         GEMM_M, GEMM_N, GEMM_K, n, -range, range, M_W, M_IW);
+
+  for (int t = 0; t < n; t++) {
+    matrix<elem_t, GEMM_M, GEMM_K> A;
+    matrix<elem_t, GEMM_K, GEMM_N> B;
+    hls::FIFO<vec<elem_t, GEMM_M>> a_cols(GEMM_K);
+    hls::FIFO<vec<elem_t, GEMM_N>> b_rows(GEMM_K);
+    hls::FIFO<vec<out_t, GEMM_N>> c_rows(GEMM_M);
+
+    for (int k = 0; k < GEMM_K; k++) {
+      vec<elem_t, GEMM_M> a;
+      vec<elem_t, GEMM_N> b;
+      for (int i = 0; i < GEMM_M; i++)
+        a[i] = A(i, k) = rand_in(range);
+      for (int j = 0; j < GEMM_N; j++)
+        b[j] = B(k, j) = rand_in(range);
+      a_cols.write(a);
+      b_rows.write(b);
+    }
+
+    gemm_systolic_wrapper(a_cols, b_rows, c_rows);
+    matrix<out_t, GEMM_M, GEMM_N> C = matmul<M_W, M_IW>(A, B);
+
+    for (int i = 0; i < GEMM_M; i++) {
+      vec<out_t, GEMM_N> row = c_rows.read();
+      for (int j = 0; j < GEMM_N; j++) {
+        double expect = 0;
+        for (int k = 0; k < GEMM_K; k++)
+          expect += (double)A(i, k) * (double)B(k, j);
+        double diff = fabs(expect - (double)row[j]);
+        if ((double)row[j] != (double)C(i, j))
+          diff = THRESHOLD + 1;
+        if (diff > max_diff)
+          max_diff = diff;
+        avg_diff += diff;
+        count++;
+      }
+    }
+  }
+  avg_diff /= count;
+
+  printf("gemm_systolic: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", count, max_diff, avg_diff);
+  if (avg_diff > THRESHOLD) return 1;
+  return 0;
+}
+
+int main() {
+  int RC = 0;
+
+#ifdef COSIM_EARLY_EXIT
+  // ---------------------------------------------------------------------
+  // This test will be used automatically when running cosimulation, as
+  // SmartHLS defines COSIM_EARLY_EXIT when running cosim.
+  // This test is quick, good to validate the generated verilog and see
+  // the wave form
+  // ---------------------------------------------------------------------
+  RC |= test_gemm(1, 4);
+
+#else
+  // ---------------------------------------------------------------------
+  // These tests are for software run as they call the HLS module
+  // thousands of times. Good to validate the algorithm and its parameters.
+  // ---------------------------------------------------------------------
+  RC |= test_matvec(10000, 4);
+  RC |= test_gemm(1000, 4);
+
+#endif
+
+  if (RC != 0)  printf("Errors may have occurred. Please double-check usage.\n");
+  return RC;
+}
@@ -0,0 +1,192 @@
+//  ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+
+#include "math/examples/test_utils.hpp"
+#include "math/examples/simple/configs.hpp"
+#include "math/include/hls_minifloat.hpp"
+
+// Max error allowed, in units of the last place of the result.
+#define THRESHOLD 1
+using namespace hls::math;
+
+/* Wrappers */
+fp16 fp16_fma_wrapper(fp16 a, fp16 b, fp16 c){
+#pragma HLS function pipeline top
+  return fp_fma(a, b, c);
+}
+
+fp16 fp16_exp_wrapper(fp16 x){
+#pragma HLS function pipeline top
+  return fp_exp(x);
+}
+
+fp16 fp16_log_wrapper(fp16 x){
+#pragma HLS function pipeline top
+  return fp_log(x);
+}
+
+fp16 fp16_sqrt_wrapper(fp16 x){
+#pragma HLS function pipeline top
+  return fp_sqrt(x);
+}
+
+fp16 fp16_reciprocal_wrapper(fp16 x){
+#pragma HLS function pipeline top
+  return fp_reciprocal(x);
+}
+
+bf16 bf16_fma_wrapper(bf16 a, bf16 b, bf16 c){
+#pragma HLS function pipeline top
+  return fp_fma(a, b, c);
+}
+
+ap_fixpt<M_W, M_IW> fp16_to_fixpt_wrapper(fp16 x){
+#pragma HLS function pipeline top
+  return to_fixpt<M_W, M_IW>(x);
+}
+
+fp16 fixpt_to_fp16_wrapper(ap_fixpt<M_W, M_IW> x){
+#pragma HLS function pipeline top
+  return to_fp<fp16>(x);
+}
+
+// Error of actual against expect in units of the last place of expect.
+template <typename FP>
+double ulp_error(double expect, FP actual) {
+  if (std::isnan(expect) && std::isnan(actual.to_double()))
+    return 0;
+  // Results too large for FP must overflow to infinity.
+  if (std::isinf(FP::from_double(expect).to_double()) || std::isinf(actual.to_double()))
+    return FP::from_double(expect).to_double() == actual.to_double() ? 0 : 1e9;
+  int e;
+  std::frexp(expect == 0 ? 1 : expect, &e);
+  return fabs(expect - actual.to_double()) / std::ldexp(1.0, e - 1 - FP::MANT_BITS);
+}
+
+// Runs fn on every finite fp16 in [lo, hi] and compares with cmath.
+int test_unary(const char *name, double (*cmath)(double), fp16 (*fn)(fp16), double lo, double hi){
+  double max_diff = 0, avg_diff = 0;
+  int count = 0;
+
+  printf("%s: every fp16 in [%f, %f]\n", name, lo, hi);
+  for (unsigned int b = 0; b < (1 << 16); b++) {
+    fp16 x;
+    x.bits = b;
+    double xd = x.to_double();
+    if (!(xd >= lo && xd <= hi))
+      continue;
+    // Results that are subnormal in fp16 are flushed to zero.
+    double expect = fp16::from_double(cmath(xd)).to_double();
+    double diff = ulp_error(cmath(xd), fn(x));
+    if (expect == 0)
+      continue;
+    if (diff > max_diff)
+      max_diff = diff;
+    avg_diff += diff;
+    count++;
+  }
+  avg_diff /= count;
+
+  printf("%s: Count: %d\tMax error: %lf ulp\tAvg error: %lf ulp\n\n", name, count, max_diff, avg_diff);
+  if (max_diff > THRESHOLD) return 1;
+  return 0;
+}
+
+// Runs the FMA on n random operands; the result must be correctly rounded.
+template <typename FP>
+int test_fma(const char *name, FP (*fn)(FP, FP, FP), int n){
+  int count = 0, wrong = 0;
+  srand(0);
+
+  printf("%s: %d random operands\n", name, n);
+  for (int i = 0; i < n; i++) {
+    FP a = FP::from_double(ldexp(2.0 * rand() / RAND_MAX - 1, rand() % 16 - 8));
+    FP b = FP::from_double(ldexp(2.0 * rand() / RAND_MAX - 1, rand() % 16 - 8));
+    FP c = FP::from_double(ldexp(2.0 * rand() / RAND_MAX - 1, rand() % 16 - 8));
+    // The product of two 11-bit mantissas is exact in a double and so is the
+    // sum for these exponent ranges, so this is a correctly rounded reference.
+    double expect = FP::from_double(a.to_double() * b.to_double() + c.to_double()).to_double();
+    if (fn(a, b, c).to_double() != expect)
+      wrong++;
+    count++;
+  }
+
+  printf("%s: Count: %d\tIncorrectly rounded: %d\n\n", name, count, wrong);
+  if (wrong) return 1;
+  return 0;
+}
+
+// Converts every fp16 in range to ap_fixpt and back.
+int test_conversion(){
+  int count = 0, wrong = 0;
+  double lsb = ldexp(1.0, M_IW - M_W);
+
+  printf("conversion: fp16 <-> ap_fixpt<%d, %d>\n", M_W, M_IW);
+  for (unsigned int b = 0; b < (1 << 16); b++) {
+    fp16 x;
+    x.bits = b;
+    double xd = x.to_double();
+    // Only the values that ap_fixpt can hold exactly.
+    if (!std::isfinite(xd) || fabs(xd) >= ldexp(1.0, M_IW - 1) || std::fmod(xd, lsb) != 0)
+      continue;
+    ap_fixpt<M_W, M_IW> f = fp16_to_fixpt_wrapper(x);
+    if ((double)f != xd || fixpt_to_fp16_wrapper(f).to_double() != xd)
+      wrong++;
+    count++;
+  }
+
+  printf("conversion: Count: %d\tWrong: %d\n\n", count, wrong);
+  if (wrong) return 1;
+  return 0;
+}
+
+double reciprocal_cmath(double x) { return 1 / x; }
+
+int main() {
+  int RC = 0;
+
+#ifdef COSIM_EARLY_EXIT
+  // ---------------------------------------------------------------------
+  // This test will be used automatically when running cosimulation, as
+  // SmartHLS defines COSIM_EARLY_EXIT when running cosim.
+  // This test is quick, good to validate the generated verilog and see
+  // the wave form
+  // ---------------------------------------------------------------------
+  RC |= test_fma("fp16_fma", fp16_fma_wrapper, 16);
+
+#else
+  // ---------------------------------------------------------------------
+  // These tests are for software run as they call the HLS module
+  // thousands of times. Good to validate the algorithm and its parameters.
+  // ---------------------------------------------------------------------
+  RC |= test_fma("fp16_fma", fp16_fma_wrapper, 100000);
+  RC |= test_fma("bf16_fma", bf16_fma_wrapper, 100000);
+  RC |= test_unary("fp16_exp", exp, fp16_exp_wrapper, -20, 12);
+  RC |= test_unary("fp16_log", log, fp16_log_wrapper, 0, 65504);
+  RC |= test_unary("fp16_sqrt", sqrt, fp16_sqrt_wrapper, 0, 65504);
+  RC |= test_unary("fp16_reciprocal", reciprocal_cmath, fp16_reciprocal_wrapper, -65504, 65504);
+  RC |= test_conversion();
+
+#endif
+
+  if (RC != 0)  printf("Errors may have occurred. Please double-check usage.\n");
+  return RC;
+}
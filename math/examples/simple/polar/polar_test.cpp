@@ -0,0 +1,156 @@
+//  ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#include "math/examples/test_utils.hpp"
+#include "math/examples/simple/configs.hpp"
+#include "math/include/hls_polar.hpp"
+
+#define THRESHOLD 1
+// Radius of the circle the test points are taken from.
+#define RADIUS 3.0
+using namespace hls::math;
+
+/* Wrappers */
+void polar_hls_M_wrapper(ap_fixpt<M_W, M_IW> x, ap_fixpt<M_W, M_IW> y,
+                         ap_fixpt<M_W, M_IW> &mag, ap_fixpt<M_W, M_IW> &phase){
+#pragma HLS function pipeline top
+  polar<M_N_ITER>(x, y, mag, phase);
+}
+
+void polar_hls_S_wrapper(ap_fixpt<S_W, S_IW> x, ap_fixpt<S_W, S_IW> y,
+                         ap_fixpt<S_W, S_IW> &mag, ap_fixpt<S_W, S_IW> &phase){
+#pragma HLS function pipeline top
+  polar<S_N_ITER>(x, y, mag, phase);
+}
+
+double atan2_cmath_wrapper(double y, double x){
+#pragma HLS function top
+  return atan2(y, x);
+}
+
+// Sweeps the angle t from start_at to limit on a circle of radius RADIUS and
+// compares the phase and magnitude against the C library.
+int test(double start_at, double limit, double delta, unsigned int W, int IW, int N_ITER = -1, int graph = 0, int report = 0){
+  double max_diff = 0, avg_diff = 0;
+  double max_diff_mag = 0, avg_diff_mag = 0;
+  int count = 0;
+  std::string test_name = find_test_name("polar", W, IW, start_at, limit, N_ITER);
+
+  FILE* fp = fopen(test_name.c_str(), "w");
+  if (graph) fprintf(fp, "# PLOT ");
+  if (report) fprintf(fp, "# REPORT ");
+  fprintf(fp, "\n# from %f to %f at intervals of %f, using W: %d, IW: %d\n", start_at, limit, delta, W, IW);
+  fprintf(fp, "# t,expected,atan2_hls,hypot_hls,atan2_hls diff,hypot_hls diff\t\n");
+
+  printf("From %f to %f at intervals of %f, using W: %d, IW: %d\n", start_at, limit, delta, W, IW);
+
+  for (double t = start_at; t <= limit; t += delta) {
+    double x = RADIUS * cos(t), y = RADIUS * sin(t);
+    double expect = 0, expect_mag = 0;
+    double actual = 0, actual_mag = 0;
+
+    if (W == M_W && IW == M_IW){
+      ap_fixpt<M_W, M_IW> x_fixpt = x, y_fixpt = y, mag, phase;
+      polar_hls_M_wrapper(x_fixpt, y_fixpt, mag, phase);
+      expect = atan2_cmath_wrapper((double)y_fixpt, (double)x_fixpt);
+      expect_mag = hypot((double)x_fixpt, (double)y_fixpt);
+      actual = (double)phase;
+      actual_mag = (double)mag;
+    }
+    else if (W == S_W && IW == S_IW){
+      ap_fixpt<S_W, S_IW> x_fixpt = x, y_fixpt = y, mag, phase;
+      polar_hls_S_wrapper(x_fixpt, y_fixpt, mag, phase);
+      expect = atan2_cmath_wrapper((double)y_fixpt, (double)x_fixpt);
+      expect_mag = hypot((double)x_fixpt, (double)y_fixpt);
+      actual = (double)phase;
+      actual_mag = (double)mag;
+    }
+
+    // -pi and pi are the same angle.
+    double diff = fabs(expect - actual);
+    if (diff > M_PI)
+      diff = fabs(diff - 2 * M_PI);
+    if (diff > max_diff)
+      max_diff = diff;
+    avg_diff += diff;
+
+    double diff_mag = fabs(expect_mag - actual_mag);
+    if (diff_mag > max_diff_mag)
+      max_diff_mag = diff_mag;
+    avg_diff_mag += diff_mag;
+    count++;
+
+    fprintf(fp, "%f,%lf,%lf,%lf,%lf,%lf\n", t, expect, actual, actual_mag, diff, diff_mag);
+  }
+  avg_diff /= count;
+  avg_diff_mag /= count;
+
+  fprintf(fp, "# atan2_cmath: Count: %d\tMax error: 0.000000\tAvg error: 0.000000\n", count);
+  fprintf(fp, "# atan2_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff, avg_diff);
+  fprintf(fp, "# hypot_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff_mag, avg_diff_mag);
+
+  printf("atan2_cmath: Count: %d\tMax error: 0.000000\tAvg error: 0.000000\n", count);
+  printf("atan2_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff, avg_diff);
+  printf("hypot_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", count, max_diff_mag, avg_diff_mag);
+
+  fclose(fp);
+  if (avg_diff > THRESHOLD || avg_diff_mag > THRESHOLD) return 1;
+  return 0;
+}
+
+int main() {
+  double start;
+  double limit;
+  double delta;
+  int RC = 0;
+  create_dir("polar_reports");
+
+#ifdef COSIM_EARLY_EXIT
+  // ---------------------------------------------------------------------
+  // This test will be used automatically when running cosimulation, as
+  // SmartHLS defines COSIM_EARLY_EXIT when running cosim.
+  // This test is quick, good to validate the generated verilog and see
+  // the wave form
+  // ---------------------------------------------------------------------
+  start = -M_PI; limit = M_PI; delta = 0.1;
+  RC |= test(start, limit, delta, M_W, M_IW, M_N_ITER, 1, 1);
+
+#else
+  // ---------------------------------------------------------------------
+  // These tests are for software run as they call the HLS module
+  // thousands of times. Good to validate the algorithm and its parameters.
+  // ---------------------------------------------------------------------
+
+  // Full circle, all four quadrants
+  start = -M_PI; limit = M_PI; delta = 0.001;
+  RC |= test(start, limit, delta, M_W, M_IW, M_N_ITER, 1, 1);
+  RC |= test(start, limit, delta, S_W, S_IW, S_N_ITER, 1, 1);
+
+  // Single angle tests on the axes
+  test(0, 0, 1, M_W, M_IW, M_N_ITER);
+  test(M_PI_2, M_PI_2, 1, M_W, M_IW, M_N_ITER);
+  test(M_PI, M_PI, 1, M_W, M_IW, M_N_ITER);
+  test(-M_PI_2, -M_PI_2, 1, M_W, M_IW, M_N_ITER);
+
+#endif
+
+  if (RC != 0)  printf("Errors may have occurred. Please double-check usage.\n");
+  return RC;
+}
@@ -0,0 +1,7 @@
+source $env(SHLS_ROOT_DIR)/examples/shls.tcl
+set_project PolarFire MPF300 hw_only
+
+#set_parameter CLOCK_PERIOD 4
+#set_parameter SYNTHESIS_CLOCK_PERIOD 4
+set_parameter CLOCK_PERIOD 2.5
+set_synthesis_top_module sin_poly_M_wrapper_top
\ No newline at end of file
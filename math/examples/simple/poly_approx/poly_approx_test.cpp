@@ -0,0 +1,145 @@
+//  ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#include "math/examples/test_utils.hpp"
+#include "math/examples/simple/configs.hpp"
+#include "math/include/hls_sin.hpp"
+#include "math/include/hls_exp.hpp"
+#include "math/include/hls_poly_approx.hpp"
+
+#define THRESHOLD 1
+using namespace hls::math;
+
+struct Sin { double operator()(double x) const { return std::sin(x); } };
+struct Exp { double operator()(double x) const { return std::exp(x); } };
+
+// sin on [0, 2), which covers [0, pi/2], 32 segments of degree 2.
+static const piecewise_poly<Sin, 0, 1, 5, 2, 24, 2> sin_poly;
+// exp on [-4, 4), 64 segments of degree 2.
+static const piecewise_poly<Exp, -4, 3, 6, 2, 32, 8> exp_poly;
+
+/* Wrappers */
+ap_fixpt<M_W, M_IW> sin_poly_M_wrapper(ap_fixpt<M_W, M_IW> x){
+#pragma HLS function pipeline top
+  return sin_poly.eval<M_W, M_IW>(x);
+}
+
+ap_fixpt<M_W, M_IW> sin_lut_M_wrapper(ap_fixpt<M_W, M_IW> x){
+#pragma HLS function pipeline top
+  return sin_lut<M_W, M_IW>(x);
+}
+
+ap_fixpt<M_W, M_IW> exp_poly_M_wrapper(ap_fixpt<M_W, M_IW> x){
+#pragma HLS function pipeline top
+  return exp_poly.eval<M_W, M_IW>(x);
+}
+
+ap_fixpt<M_W, M_IW> exp_taylor_M_wrapper(ap_fixpt<M_W, M_IW> x){
+#pragma HLS function pipeline top
+  return exp_taylor<M_W, M_IW>(x);
+}
+
+// Compares the piecewise polynomial (poly) against the existing implementation
+// of the same function (ref) and the C library.
+int test(const char *name, double (*cmath)(double),
+         ap_fixpt<M_W, M_IW> (*poly)(ap_fixpt<M_W, M_IW>),
+         ap_fixpt<M_W, M_IW> (*ref)(ap_fixpt<M_W, M_IW>),
+         double start_at, double limit, double delta, int graph = 0, int report = 0){
+  double max_diff = 0, avg_diff = 0;
+  double max_diff_ref = 0, avg_diff_ref = 0;
+  int count = 0;
+  std::string test_name = find_test_name(name, M_W, M_IW, start_at, limit);
+
+  FILE* fp = fopen(test_name.c_str(), "w");
+  if (graph) fprintf(fp, "# PLOT ");
+  if (report) fprintf(fp, "# REPORT ");
+  fprintf(fp, "\n# from %f to %f at intervals of %f, using W: %d, IW: %d\n", start_at, limit, delta, M_W, M_IW);
+  fprintf(fp, "# x,expected,%s_poly,%s_ref,%s_poly diff,%s_ref diff\t\n", name, name, name, name);
+
+  printf("%s: from %f to %f at intervals of %f, using W: %d, IW: %d\n", name, start_at, limit, delta, M_W, M_IW);
+
+  for (double x = start_at; x <= limit; x += delta) {
+    ap_fixpt<M_W, M_IW> x_fixpt = x;
+    double expect = cmath((double)x_fixpt);
+    double actual = (double)poly(x_fixpt);
+    double actual_ref = (double)ref(x_fixpt);
+
+    double diff = fabs(expect - actual);
+    if (diff > max_diff)
+      max_diff = diff;
+    avg_diff += diff;
+
+    double diff_ref = fabs(expect - actual_ref);
+    if (diff_ref > max_diff_ref)
+      max_diff_ref = diff_ref;
+    avg_diff_ref += diff_ref;
+    count++;
+
+    fprintf(fp, "%f,%lf,%lf,%lf,%lf,%lf\n", x, expect, actual, actual_ref, diff, diff_ref);
+  }
+  avg_diff /= count;
+  avg_diff_ref /= count;
+
+  fprintf(fp, "# %s_poly: Count: %d\tMax error: %lf\tAvg error: %lf\n", name, count, max_diff, avg_diff);
+  fprintf(fp, "# %s_ref: Count: %d\tMax error: %lf\tAvg error: %lf\n", name, count, max_diff_ref, avg_diff_ref);
+
+  printf("%s_poly: Count: %d\tMax error: %lf\tAvg error: %lf\n", name, count, max_diff, avg_diff);
+  printf("%s_ref: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", name, count, max_diff_ref, avg_diff_ref);
+
+  fclose(fp);
+  if (avg_diff > THRESHOLD) return 1;
+  return 0;
+}
+
+double sin_cmath(double x) { return sin(x); }
+double exp_cmath(double x) { return exp(x); }
+
+int main() {
+  int RC = 0;
+  create_dir("sin_reports");
+  create_dir("exp_reports");
+
+#ifdef COSIM_EARLY_EXIT
+  // ---------------------------------------------------------------------
+  // This test will be used automatically when running cosimulation, as
+  // SmartHLS defines COSIM_EARLY_EXIT when running cosim.
+  // This test is quick, good to validate the generated verilog and see
+  // the wave form
+  // ---------------------------------------------------------------------
+  RC |= test("sin", sin_cmath, sin_poly_M_wrapper, sin_lut_M_wrapper, 0, M_PI_2, 0.1, 1, 1);
+
+#else
+  // ---------------------------------------------------------------------
+  // These tests are for software run as they call the HLS module
+  // thousands of times. Good to validate the algorithm and its parameters.
+  // ---------------------------------------------------------------------
+  RC |= test("sin", sin_cmath, sin_poly_M_wrapper, sin_lut_M_wrapper, 0, M_PI_2, 0.0001, 1, 1);
+  RC |= test("exp", exp_cmath, exp_poly_M_wrapper, exp_taylor_M_wrapper, -4, 3.99, 0.0001, 1, 1);
+
+  // Segment bits needed for a 2^-16 error at each degree, to help pick the
+  // template arguments.
+  for (int d = 1; d <= 3; d++)
+    printf("sin, degree %d: %d segment bits for 2^-16\n", d, poly_segment_bits(Sin(), 0, 1, d, pow(2, -16)));
+
+#endif
+
+  if (RC != 0)  printf("Errors may have occurred. Please double-check usage.\n");
+  return RC;
+}
@@ -0,0 +1,136 @@
+//  ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+
+#include "math/examples/test_utils.hpp"
+#include "math/examples/simple/configs.hpp"
+#include "math/include/hls_qr.hpp"
+
+#define THRESHOLD 1
+#define QR_N 4
+#define QR_ROWS 64
+#define CORDIC_ITERATIONS 16
+using namespace hls::math;
+
+// R grows with the square root of the number of rows, so it needs a few
+// more integer bits than the inputs.
+typedef ap_fixpt<32, 10> elem_t;
+typedef ap_fixpt<M_W, M_IW> out_t;
+
+/* Wrappers */
+void lstsq_wrapper(hls::FIFO<vec<elem_t, QR_N + 1>> &rows, hls::FIFO<vec<out_t, QR_N>> &solutions){
+#pragma HLS function top
+  lstsq_stream<M_W, M_IW, CORDIC_ITERATIONS, 2>(rows, solutions, QR_ROWS);
+}
+
+// Double precision least squares through the normal equations, good enough
+// for the well-conditioned random problems used here.
+void lstsq_reference(double A[QR_ROWS][QR_N + 1], double x[QR_N]){
+  double M[QR_N][QR_N + 1] = {};
+  for (int r = 0; r < QR_ROWS; r++)
+    for (int i = 0; i < QR_N; i++)
+      for (int j = 0; j < QR_N + 1; j++)
+        M[i][j] += A[r][i] * A[r][j];
+  for (int i = 0; i < QR_N; i++)
+    for (int k = i + 1; k < QR_N; k++) {
+      double f = M[k][i] / M[i][i];
+      for (int j = i; j < QR_N + 1; j++)
+        M[k][j] -= f * M[i][j];
+    }
+  for (int i = QR_N - 1; i >= 0; i--) {
+    double s = M[i][QR_N];
+    for (int j = i + 1; j < QR_N; j++)
+      s -= M[i][j] * x[j];
+    x[i] = s / M[i][i];
+  }
+}
+
+// Solves n random noisy systems A x = b with QR_ROWS rows each.
+int test_lstsq(int n, double noise){
+  double max_diff = 0, avg_diff = 0;
+  int count = 0;
+  srand(0);
+
+  printf("lstsq %dx%d: %d systems with noise %f, using W: %d, IW: %d\n",
+         QR_ROWS, QR_N, n, noise, M_W, M_IW);
+
+  for (int t = 0; t < n; t++) {
+    double A[QR_ROWS][QR_N + 1], x_true[QR_N], expect[QR_N];
+    hls::FIFO<vec<elem_t, QR_N + 1>> rows(QR_ROWS);
+    hls::FIFO<vec<out_t, QR_N>> solutions(1);
+
+    for (int i = 0; i < QR_N; i++)
+      x_true[i] = 4.0 * rand() / RAND_MAX - 2;
+    for (int r = 0; r < QR_ROWS; r++) {
+      vec<elem_t, QR_N + 1> row;
+      double b = noise * (2.0 * rand() / RAND_MAX - 1);
+      for (int i = 0; i < QR_N; i++) {
+        row[i] = 2.0 * rand() / RAND_MAX - 1;
+        A[r][i] = (double)row[i];
+        b += A[r][i] * x_true[i];
+      }
+      row[QR_N] = b;
+      A[r][QR_N] = (double)row[QR_N];
+      rows.write(row);
+    }
+
+    lstsq_wrapper(rows, solutions);
+    lstsq_reference(A, expect);
+
+    vec<out_t, QR_N> x = solutions.read();
+    for (int i = 0; i < QR_N; i++) {
+      double diff = fabs(expect[i] - (double)x[i]);
+      if (diff > max_diff)
+        max_diff = diff;
+      avg_diff += diff;
+      count++;
+    }
+  }
+  avg_diff /= count;
+
+  printf("lstsq: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", count, max_diff, avg_diff);
+  if (avg_diff > THRESHOLD) return 1;
+  return 0;
+}
+
+int main() {
+  int RC = 0;
+
+#ifdef COSIM_EARLY_EXIT
+  // ---------------------------------------------------------------------
+  // This test will be used automatically when running cosimulation, as
+  // SmartHLS defines COSIM_EARLY_EXIT when running cosim.
+  // This test is quick, good to validate the generated verilog and see
+  // the wave form
+  // ---------------------------------------------------------------------
+  RC |= test_lstsq(1, 0.01);
+
+#else
+  // ---------------------------------------------------------------------
+  // These tests are for software run as they call the HLS module
+  // thousands of times. Good to validate the algorithm and its parameters.
+  // ---------------------------------------------------------------------
+  RC |= test_lstsq(1000, 0.01);
+
+#endif
+
+  if (RC != 0)  printf("Errors may have occurred. Please double-check usage.\n");
+  return RC;
+}
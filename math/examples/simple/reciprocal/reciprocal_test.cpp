@@ -0,0 +1,167 @@
+//  ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#include "math/examples/test_utils.hpp"
+#include "math/examples/simple/configs.hpp"
+#include "math/include/hls_reciprocal.hpp"
+
+#define THRESHOLD 1
+// Newton-Raphson iterations on top of the 8-bit seed table. Two iterations are
+// enough for 32-bit outputs.
+#define RECIP_N_ITER 2
+using namespace hls::math;
+
+/* Wrappers */
+ap_fixpt<M_W, M_IW> reciprocal_hls_M_wrapper(ap_fixpt<M_W, M_IW> x){
+#pragma HLS function pipeline top
+  return reciprocal<M_W, M_IW, RECIP_N_ITER>(x);
+}
+
+ap_fixpt<S_W, S_IW> reciprocal_hls_S_wrapper(ap_fixpt<S_W, S_IW> x){
+#pragma HLS function pipeline top
+  return reciprocal<S_W, S_IW, RECIP_N_ITER>(x);
+}
+
+ap_fixpt<M_W, M_IW> divide_hls_M_wrapper(ap_fixpt<M_W, M_IW> a, ap_fixpt<M_W, M_IW> b){
+#pragma HLS function pipeline top
+  return divide<M_W, M_IW, RECIP_N_ITER>(a, b);
+}
+
+ap_fixpt<S_W, S_IW> divide_hls_S_wrapper(ap_fixpt<S_W, S_IW> a, ap_fixpt<S_W, S_IW> b){
+#pragma HLS function pipeline top
+  return divide<S_W, S_IW, RECIP_N_ITER>(a, b);
+}
+
+double reciprocal_cmath_wrapper(double x){
+#pragma HLS function top
+  return 1.0 / x;
+}
+
+int test(double start_at, double limit, double delta, unsigned int W, int IW, int N_ITER = -1, int graph = 0, int report = 0){
+  double max_diff = 0, avg_diff = 0;
+  double max_diff_div = 0, avg_diff_div = 0;
+  int count = 0;
+  std::string test_name = find_test_name("reciprocal", W, IW, start_at, limit, N_ITER);
+
+  FILE* fp = fopen(test_name.c_str(), "w");
+  if (graph) fprintf(fp, "# PLOT ");
+  if (report) fprintf(fp, "# REPORT ");
+  fprintf(fp, "\n# from %f to %f at intervals of %f, using W: %d, IW: %d\n", start_at, limit, delta, W, IW);
+  fprintf(fp, "# x,expected,reciprocal_hls,divide_hls,reciprocal_hls diff,divide_hls diff\t\n");
+
+  printf("From %f to %f at intervals of %f, using W: %d, IW: %d\n", start_at, limit, delta, W, IW);
+
+  for (double x = start_at; x <= limit; x += delta) {
+    double expect = 0;
+    double actual = 0;
+    double actual_div = 0;
+    double expect_div = 0;
+
+    if (W == M_W && IW == M_IW){
+      ap_fixpt<M_W, M_IW> x_fixpt = x;
+      // Divide 1.5 by x so the dividend is not just 1.
+      ap_fixpt<M_W, M_IW> a_fixpt = 1.5;
+      expect = reciprocal_cmath_wrapper((double)x_fixpt);
+      expect_div = 1.5 * expect;
+      actual = (double)reciprocal_hls_M_wrapper(x_fixpt);
+      actual_div = (double)divide_hls_M_wrapper(a_fixpt, x_fixpt);
+    }
+    else if (W == S_W && IW == S_IW){
+      ap_fixpt<S_W, S_IW> x_fixpt = x;
+      // Divide 0.75 by x so the dividend is not just 1.
+      ap_fixpt<S_W, S_IW> a_fixpt = 0.75;
+      expect = reciprocal_cmath_wrapper((double)x_fixpt);
+      expect_div = 0.75 * expect;
+      actual = (double)reciprocal_hls_S_wrapper(x_fixpt);
+      actual_div = (double)divide_hls_S_wrapper(a_fixpt, x_fixpt);
+    }
+
+    double diff = fabs(expect - actual);
+    if (diff > max_diff)
+      max_diff = diff;
+    avg_diff += diff;
+
+    double diff_div = fabs(expect_div - actual_div);
+    if (diff_div > max_diff_div)
+      max_diff_div = diff_div;
+    avg_diff_div += diff_div;
+    count++;
+
+    fprintf(fp, "%f,%lf,%lf,%lf,%lf,%lf\n", x, expect, actual, actual_div, diff, diff_div);
+  }
+  avg_diff /= count;
+  avg_diff_div /= count;
+
+  fprintf(fp, "# reciprocal_cmath: Count: %d\tMax error: 0.000000\tAvg error: 0.000000\n", count);
+  fprintf(fp, "# reciprocal_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff, avg_diff);
+  fprintf(fp, "# divide_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff_div, avg_diff_div);
+
+  printf("reciprocal_cmath: Count: %d\tMax error: 0.000000\tAvg error: 0.000000\n", count);
+  printf("reciprocal_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff, avg_diff);
+  printf("divide_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", count, max_diff_div, avg_diff_div);
+
+  fclose(fp);
+  if (avg_diff > THRESHOLD || avg_diff_div > THRESHOLD) return 1;
+  return 0;
+}
+
+int main() {
+  double start;
+  double limit;
+  double delta;
+  int RC = 0;
+  create_dir("reciprocal_reports");
+
+#ifdef COSIM_EARLY_EXIT
+  // ---------------------------------------------------------------------
+  // This test will be used automatically when running cosimulation, as
+  // SmartHLS defines COSIM_EARLY_EXIT when running cosim.
+  // This test is quick, good to validate the generated verilog and see
+  // the wave form
+  // ---------------------------------------------------------------------
+  start = 0.1; limit = 10; delta = 0.1;
+  RC |= test(start, limit, delta, M_W, M_IW, RECIP_N_ITER, 1, 1);
+
+#else
+  // ---------------------------------------------------------------------
+  // These tests are for software run as they call the HLS module
+  // thousands of times. Good to validate the algorithm and its parameters.
+  // ---------------------------------------------------------------------
+
+  // Normal tests, both signs
+  start = 0.01; limit = 100; delta = 0.01;
+  RC |= test(start, limit, delta, M_W, M_IW, RECIP_N_ITER, 1, 1);
+  start = -100; limit = -0.01; delta = 0.01;
+  RC |= test(start, limit, delta, M_W, M_IW, RECIP_N_ITER, 1, 1);
+
+  // test larger numbers with a small output
+  start = 1.0; limit = 100.0; delta = 0.001;
+  RC |= test(start, limit, delta, S_W, S_IW, RECIP_N_ITER, 1, 1);
+
+  // Single number tests
+  test(4.0, 4.0, 1.0, M_W, M_IW, RECIP_N_ITER);
+  test(0.5, 0.5, 1.0, M_W, M_IW, RECIP_N_ITER);
+  test(0, 0, 1, M_W, M_IW, RECIP_N_ITER); //Test invalid argument
+
+#endif
+
+  if (RC != 0)  printf("Errors may have occurred. Please double-check usage.\n");
+  return RC;
+}
@@ -44,6 +44,13 @@ sincos_struct_M sincos_cordic_M_wrapper(ap_fixpt<M_W, M_IW> x, ap_fixpt<M_W, M_I
   return (r);
 }
 
+sincos_struct_M sincos_lut_M_wrapper(ap_fixpt<M_W, M_IW> x){
+#pragma HLS function pipeline top
+  sincos_struct_M r;
+  sincos_lut(x, r.sin, r.cos);
+  return (r);
+}
+
 void sincos_cmath_wrapper(double x, double* s, double* c){
 #pragma HLS interface argument(s) type(memory) num_elements(1)	
 #pragma HLS interface argument(c) type(memory) num_elements(1)	
@@ -51,12 +58,13 @@ void sincos_cmath_wrapper(double x, double* s, double* c){
   sincos(x, s, c);
 }
 
-int test(double start_at, double limit, double delta, unsigned int W, int IW, int N_ITER = -1, int graph = 0, int report = 0) {
+int test(double start_at, double limit, double delta, unsigned int W, int IW, int N_ITER = -1, int graph = 0, int report = 0, int lut = 0) {
   double max_diff_sin = 0, avg_diff_sin = 0, max_diff_cos = 0, avg_diff_cos = 0;
   double diff_cos = 0, diff_sin = 0;
   ap_fixpt<M_W, M_IW> actual_sin = 0, actual_cos=0;
   int count = 0;
-  std::string test_name = find_test_name("sincos", W, IW, start_at, limit, N_ITER);
+  const char *name = lut ? "sincos_lut" : "sincos_cordic";
+  std::string test_name = find_test_name(lut ? "sincos_lut" : "sincos", W, IW, start_at, limit, N_ITER);
 
   FILE* fp = fopen(test_name.c_str(), "w");
   if (graph) fprintf(fp, "# PLOT ");
@@ -72,7 +80,8 @@ int test(double start_at, double limit, double delta, unsigned int W, int IW, in
     double* expect_sin = (double*)malloc(sizeof(double));
     double* expect_cos = (double*)malloc(sizeof(double));
     sincos_cmath_wrapper(x, expect_sin, expect_cos);
-    sincos_struct_M r = sincos_cordic_M_wrapper(x_fixpt, actual_sin, actual_cos);
+    sincos_struct_M r = lut ? sincos_lut_M_wrapper(x_fixpt)
+                            : sincos_cordic_M_wrapper(x_fixpt, actual_sin, actual_cos);
     
     diff_cos = fabs(*expect_cos - (double)r.cos);
     diff_sin = fabs(*expect_sin - (double)r.sin);
@@ -94,10 +103,10 @@ int test(double start_at, double limit, double delta, unsigned int W, int IW, in
   double max_diff = (max_diff_sin > max_diff_cos) ? max_diff_sin : max_diff_cos;
 
   fprintf(fp, "# sincos_cmath: Count: %d\tMax error: 0.000000\tAvg error: 0.000000\n", count);
-  fprintf(fp, "# sincos_cordic: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff, avg_diff);
+  fprintf(fp, "# %s: Count: %d\tMax error: %lf\tAvg error: %lf\n", name, count, max_diff, avg_diff);
 
   printf("sincos_cmath: Count: %d\tMax error: 0.000000\tAvg error: 0.000000\n", count);
-  printf("sincos_cordic: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff, avg_diff);
+  printf("%s: Count: %d\tMax error: %lf\tAvg error: %lf\n", name, count, max_diff, avg_diff);
   fclose(fp);
 
 //  if (avg_diff > THRESHOLD )
@@ -109,6 +118,7 @@ int test(double start_at, double limit, double delta, unsigned int W, int IW, in
 int main() {
 
   create_dir("sincos_reports");
+  create_dir("sincos_lut_reports");
 
   double start;
   double limit;
@@ -118,6 +128,7 @@ int main() {
   // Medium Test
   start = -4 * M_PI; limit = 4 * M_PI;  delta = (0.1);
   RC |= test(start, limit, delta, M_W, M_IW, M_N_ITER, 0, 1); 
+  RC |= test(start, limit, delta, M_W, M_IW, M_N_ITER, 0, 1, 1);
 
   if (RC != 0)  printf("Errors may have occurred. Please double-check usage.\n");
   return RC;
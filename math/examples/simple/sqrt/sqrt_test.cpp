@@ -24,6 +24,9 @@
 
 #define THRESHOLD 2
 #define PARSE 1
+// Newton-Raphson iterations of rsqrt on top of the 8-bit seed table. Two
+// iterations are enough for 32-bit outputs.
+#define RSQRT_N_ITER 2
 using namespace hls::math;
 
 ap_ufixpt<L_W, L_IW> sqrt_hls_L_wrapper(ap_ufixpt<L_W, L_IW> x){
@@ -41,6 +44,42 @@ ap_ufixpt<S_W, S_IW> sqrt_hls_S_wrapper(ap_ufixpt<S_W, S_IW> x){
   return sqrt<S_W, S_IW, S_N_ITER>(x);
 }
 
+ap_ufixpt<L_W, L_IW> sqrt_nonrestoring_L_wrapper(ap_ufixpt<L_W, L_IW> x){
+#pragma HLS function pipeline top
+  return sqrt_nonrestoring<L_W, L_IW>(x);
+}
+
+ap_ufixpt<M_W, M_IW> sqrt_nonrestoring_M_wrapper(ap_ufixpt<M_W, M_IW> x){
+#pragma HLS function pipeline top
+  return sqrt_nonrestoring<M_W, M_IW>(x);
+}
+
+ap_ufixpt<S_W, S_IW> sqrt_nonrestoring_S_wrapper(ap_ufixpt<S_W, S_IW> x){
+#pragma HLS function pipeline top
+  return sqrt_nonrestoring<S_W, S_IW>(x);
+}
+
+// rsqrt of the L inputs, which are at least 1, is at most 1.
+ap_ufixpt<L_W, 1> rsqrt_hls_L_wrapper(ap_ufixpt<L_W, L_IW> x){
+#pragma HLS function pipeline top
+  return rsqrt<L_W, 1, RSQRT_N_ITER>(x);
+}
+
+ap_ufixpt<M_W, M_IW> rsqrt_hls_M_wrapper(ap_ufixpt<M_W, M_IW> x){
+#pragma HLS function pipeline top
+  return rsqrt<M_W, M_IW, RSQRT_N_ITER>(x);
+}
+
+ap_ufixpt<S_W, S_IW> rsqrt_hls_S_wrapper(ap_ufixpt<S_W, S_IW> x){
+#pragma HLS function pipeline top
+  return rsqrt<S_W, S_IW, RSQRT_N_ITER>(x);
+}
+
+double rsqrt_cmath_wrapper(double x){
+#pragma HLS function top
+  return 1.0 / sqrt(x);
+}
+
 double sqrt_cmath_wrapper(double x){
 #pragma HLS function top
   return sqrt(x);
@@ -48,6 +87,7 @@ double sqrt_cmath_wrapper(double x){
 
 int test(double start_at, double limit, double delta, unsigned int W, int IW, int N_ITER = -1, int graph = 0, int report = 0){
   double max_diff = 0, avg_diff = 0;
+  double max_diff_nr = 0, avg_diff_nr = 0;
   int count = 0;
   std::string test_name = find_test_name("sqrt", W, IW, start_at, limit, N_ITER);
 
@@ -55,25 +95,29 @@ int test(double start_at, double limit, double delta, unsigned int W, int IW, in
   if (graph) fprintf(fp, "# PLOT ");
   if (report) fprintf(fp, "# REPORT ");
   fprintf(fp, "\n# from %f to %f at intervals of %f, using W: %d, IW: %d\n", start_at, limit, delta, W, IW);  
-  fprintf(fp, "# x,expected,sqrt_hls,sqrt_hls diff\t\n");
+  fprintf(fp, "# x,expected,sqrt_hls,sqrt_nonrestoring,sqrt_hls diff,sqrt_nonrestoring diff\t\n");
 
   printf("From %f to %f at intervals of %f, using W: %d, IW: %d\n", start_at, limit, delta, W, IW);
 
   for (double x = start_at; x <= limit; x += delta) {
     double expect = sqrt_cmath_wrapper(x);
     double actual = 0;
+    double actual_nr = 0;
 
     if (W == L_W && IW == L_IW){
       ap_ufixpt<L_W, L_IW> x_fixpt = x;
       actual = (double)sqrt_hls_L_wrapper(x_fixpt);
+      actual_nr = (double)sqrt_nonrestoring_L_wrapper(x_fixpt);
     }
     else if (W == M_W && IW == M_IW){
       ap_ufixpt<M_W, M_IW> x_fixpt = x;
       actual = (double)sqrt_hls_M_wrapper(x_fixpt);
+      actual_nr = (double)sqrt_nonrestoring_M_wrapper(x_fixpt);
     }
     else if (W == S_W && IW == S_IW){
       ap_ufixpt<S_W, S_IW> x_fixpt = x;
       actual = (double)sqrt_hls_S_wrapper(x_fixpt);
+      actual_nr = (double)sqrt_nonrestoring_S_wrapper(x_fixpt);
     }    
 
     double diff = fabs(expect - actual);
@@ -81,29 +125,120 @@ int test(double start_at, double limit, double delta, unsigned int W, int IW, in
     if (diff > max_diff)
       max_diff = diff;
     avg_diff += diff;
+
+    double diff_nr = fabs(expect - actual_nr);
+    if (diff_nr > max_diff_nr)
+      max_diff_nr = diff_nr;
+    avg_diff_nr += diff_nr;
     count++;
 
-    fprintf(fp, "%f,%lf,%lf,%lf\n", x, expect, actual, diff);
+    fprintf(fp, "%f,%lf,%lf,%lf,%lf,%lf\n", x, expect, actual, actual_nr, diff, diff_nr);
   }
   avg_diff /= count;
+  avg_diff_nr /= count;
 
   fprintf(fp, "# sqrt_cmath: Count: %d\tMax error: 0.000000\tAvg error: 0.000000\n", count);
   fprintf(fp, "# sqrt_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff, avg_diff);
+  fprintf(fp, "# sqrt_nonrestoring: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff_nr, avg_diff_nr);
 
   printf("sqrt_cmath: Count: %d\tMax error: 0.000000\tAvg error: 0.000000\n", count);
-  printf("sqrt_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", count, max_diff, avg_diff);
+  printf("sqrt_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff, avg_diff);
+  printf("sqrt_nonrestoring: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", count, max_diff_nr, avg_diff_nr);
+
+  fclose(fp);
+  if (avg_diff > THRESHOLD || avg_diff_nr > THRESHOLD) return 1;
+  return 0;
+}
+
+int test_rsqrt(double start_at, double limit, double delta, unsigned int W, int IW, int N_ITER = -1, int graph = 0, int report = 0){
+  double max_diff = 0, avg_diff = 0;
+  int count = 0;
+  std::string test_name = find_test_name("rsqrt", W, IW, start_at, limit, N_ITER);
+
+  FILE* fp = fopen(test_name.c_str(), "w");
+  if (graph) fprintf(fp, "# PLOT ");
+  if (report) fprintf(fp, "# REPORT ");
+  fprintf(fp, "\n# from %f to %f at intervals of %f, using W: %d, IW: %d\n", start_at, limit, delta, W, IW);
+  fprintf(fp, "# x,expected,rsqrt_hls,rsqrt_hls diff\t\n");
+
+  printf("From %f to %f at intervals of %f, using W: %d, IW: %d\n", start_at, limit, delta, W, IW);
+
+  for (double x = start_at; x <= limit; x += delta) {
+    double expect = 0;
+    double actual = 0;
+
+    if (W == L_W && IW == L_IW){
+      ap_ufixpt<L_W, L_IW> x_fixpt = x;
+      expect = rsqrt_cmath_wrapper((double)x_fixpt);
+      actual = (double)rsqrt_hls_L_wrapper(x_fixpt);
+    }
+    else if (W == M_W && IW == M_IW){
+      ap_ufixpt<M_W, M_IW> x_fixpt = x;
+      expect = rsqrt_cmath_wrapper((double)x_fixpt);
+      actual = (double)rsqrt_hls_M_wrapper(x_fixpt);
+    }
+    else if (W == S_W && IW == S_IW){
+      ap_ufixpt<S_W, S_IW> x_fixpt = x;
+      expect = rsqrt_cmath_wrapper((double)x_fixpt);
+      actual = (double)rsqrt_hls_S_wrapper(x_fixpt);
+    }
+
+    double diff = fabs(expect - actual);
+    if (diff > max_diff)
+      max_diff = diff;
+    avg_diff += diff;
+    count++;
+
+    fprintf(fp, "%f,%lf,%lf,%lf\n", x, expect, actual, diff);
+  }
+  avg_diff /= count;
+
+  fprintf(fp, "# rsqrt_cmath: Count: %d\tMax error: 0.000000\tAvg error: 0.000000\n", count);
+  fprintf(fp, "# rsqrt_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n", count, max_diff, avg_diff);
+
+  printf("rsqrt_cmath: Count: %d\tMax error: 0.000000\tAvg error: 0.000000\n", count);
+  printf("rsqrt_hls: Count: %d\tMax error: %lf\tAvg error: %lf\n\n", count, max_diff, avg_diff);
 
   fclose(fp);
   if (avg_diff > THRESHOLD) return 1;
   return 0;
 }
 
+// rsqrt(0) reports INF_ERROR and returns 0. The smallest input of the S
+// config, 2^-24, and 2^-17 have results above 256, which saturate to the
+// largest ap_ufixpt<S_W, S_IW>.
+int test_rsqrt_edges(){
+  int RC = 0;
+  int error = DEFAULT_ERROR;
+  ap_ufixpt<S_W, S_IW> zero = 0;
+  ap_ufixpt<S_W, S_IW> result = rsqrt<S_W, S_IW, RSQRT_N_ITER>(zero, error);
+  if (error != INF_ERROR || result != 0) {
+    printf("rsqrt(0): expected INF_ERROR and 0, got error %d and %f\n", error, (double)result);
+    RC = 1;
+  }
+
+  ap_ufixpt<S_W, S_IW> largest;
+  largest(S_W - 1, 0) = -1;
+  ap_ufixpt<S_W, S_IW> smallest;
+  smallest(S_W - 1, 0) = 1;
+  ap_ufixpt<S_W, S_IW> small = pow(2, -17);
+  ap_ufixpt<S_W, S_IW> inputs[2] = {smallest, small};
+  for (int i = 0; i < 2; i++) {
+    result = rsqrt_hls_S_wrapper(inputs[i]);
+    printf("rsqrt(%g) = %.8f, saturated to %.8f\n", (double)inputs[i], (double)result, (double)largest);
+    if (result != largest) RC = 1;
+  }
+  printf("\n");
+  return RC;
+}
+
 int main() {
   double start;
   double limit;
   double delta;
   int RC = 0;
   create_dir("sqrt_reports");
+  create_dir("rsqrt_reports");
 
 #ifdef COSIM_EARLY_EXIT
   // ---------------------------------------------------------------------
@@ -124,6 +259,10 @@ int main() {
   RC |= test(100.0, 100.0, 1, M_W, M_IW, M_N_ITER); 
   //test(-1, -1, 1, M_W, M_IW); //Test invalid argument
 
+  start=0.1; limit = 10; delta = 0.1;
+  RC |= test_rsqrt(start, limit, delta, M_W, M_IW, RSQRT_N_ITER, 1, 1);
+  RC |= test_rsqrt_edges();
+
 #else
   // ---------------------------------------------------------------------
   // These tests are for software run as they call the HLS module
@@ -154,6 +293,18 @@ int main() {
   test(pow(2,32)-2, pow(2,32)-2, 1, L_W, L_IW, L_N_ITER);
   test (-1, -1, 1, M_W, M_IW, M_N_ITER); //Test invalid argument
 
+  // rsqrt, compared against 1 / sqrt(x)
+  start = 1.0; limit = pow(2, 32) - 1;  delta = pow(2, 32) / 256.0;
+  RC |= test_rsqrt(start, limit, delta, L_W, L_IW, RSQRT_N_ITER, 1, 1);
+
+  start = 0.0001; limit = 1.0; delta = 0.0001;
+  RC |= test_rsqrt(start, limit, delta, S_W, S_IW, RSQRT_N_ITER, 1, 1);
+
+  start = 0.1; limit = 100; delta = 0.1;
+  RC |= test_rsqrt(start, limit, delta, M_W, M_IW, RSQRT_N_ITER, 1, 1);
+
+  RC |= test_rsqrt_edges();
+
 #endif
 
   if (RC != 0)  printf("Errors may have occurred. Please double-check usage.\n");
@@ -0,0 +1,198 @@
+//  ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+
+#include <algorithm>
+#include <vector>
+#include "math/examples/test_utils.hpp"
+#include "math/examples/simple/configs.hpp"
+#include "math/include/hls_stats.hpp"
+
+#define THRESHOLD 0.01
+#define NPPC 4
+#define CNT_W 22
+#define BIN_BITS 8
+#define N_PERCENTILES 3
+using namespace hls::math;
+
+// 8-bit pixels, with one extra bit for the sign.
+typedef ap_fixpt<9, 9> pixel_t;
+typedef stats_result<M_W, M_IW, 9, 9, CNT_W> result_t;
+
+/* Wrappers */
+void stats_stream_wrapper(hls::FIFO<vec<pixel_t, NPPC>> &in, hls::FIFO<result_t> &out,
+                          int window, int n_windows){
+#pragma HLS function top
+  stats_stream<M_W, M_IW, CNT_W, M_N_ITER>(in, out, window, n_windows);
+}
+
+void percentile_stream_wrapper(hls::FIFO<vec<pixel_t, NPPC>> &in,
+                               hls::FIFO<vec<pixel_t, N_PERCENTILES>> &out,
+                               vec<ap_ufixpt<16, 0>, N_PERCENTILES> q,
+                               int window, int n_windows){
+#pragma HLS function top
+  percentile_stream<BIN_BITS, CNT_W>(in, out, q, window, n_windows);
+}
+
+// Frame w of the test: uniform noise, a narrow band, and a ramp.
+static int test_pixel(int w, int i) {
+  switch (w % 3) {
+  case 0: return rand() % 256;
+  case 1: return 100 + rand() % 8;
+  default: return i % 256;
+  }
+}
+
+// Streams n_windows frames of `window` words through stats_stream and compares
+// with a double precision reference.
+int test_stats(int window, int n_windows){
+  double max_diff = 0, avg_diff = 0;
+  int count = 0, wrong = 0;
+  hls::FIFO<vec<pixel_t, NPPC>> in(window * n_windows);
+  hls::FIFO<result_t> out(n_windows);
+  std::vector<std::vector<int>> frames(n_windows);
+  srand(0);
+
+  printf("stats_stream: %d frames of %d x %d pixels, using W: %d, IW: %d\n",
+         n_windows, window, NPPC, M_W, M_IW);
+
+  for (int w = 0; w < n_windows; w++) {
+    for (int i = 0; i < window; i++) {
+      vec<pixel_t, NPPC> v;
+      for (int l = 0; l < NPPC; l++) {
+        int p = test_pixel(w, i * NPPC + l);
+        v[l] = p;
+        frames[w].push_back(p);
+      }
+      in.write(v);
+    }
+  }
+
+  stats_stream_wrapper(in, out, window, n_windows);
+
+  for (int w = 0; w < n_windows; w++) {
+    result_t r = out.read();
+    double mean = 0, var = 0;
+    int lo = 255, hi = 0;
+    for (int p : frames[w]) {
+      mean += p;
+      lo = std::min(lo, p);
+      hi = std::max(hi, p);
+    }
+    mean /= frames[w].size();
+    for (int p : frames[w])
+      var += (p - mean) * (p - mean);
+    var /= frames[w].size();
+
+    // The mean and the variance are compared relative to their magnitude.
+    double diff = std::max(fabs(mean - (double)r.mean) / std::max(mean, 1.0),
+                           fabs(var - (double)r.variance) / std::max(var, 1.0));
+    if (r.count != frames[w].size() || (int)r.min != lo || (int)r.max != hi)
+      wrong++;
+    if (diff > max_diff)
+      max_diff = diff;
+    avg_diff += diff;
+    count++;
+  }
+  avg_diff /= count;
+
+  printf("stats_stream: Count: %d\tWrong count/min/max: %d\tMax rel error: %lf\tAvg rel error: %lf\n\n",
+         count, wrong, max_diff, avg_diff);
+  if (wrong != 0 || avg_diff > THRESHOLD) return 1;
+  return 0;
+}
+
+// Same frames through percentile_stream. The result must be the lower edge of
+// the bin holding the reference percentile.
+int test_percentiles(int window, int n_windows){
+  const double fractions[N_PERCENTILES] = {0.05, 0.5, 0.95};
+  const int bin_width = 1 << (9 - BIN_BITS);
+  int count = 0, wrong = 0;
+  hls::FIFO<vec<pixel_t, NPPC>> in(window * n_windows);
+  hls::FIFO<vec<pixel_t, N_PERCENTILES>> out(n_windows);
+  std::vector<std::vector<int>> frames(n_windows);
+  vec<ap_ufixpt<16, 0>, N_PERCENTILES> q;
+  srand(0);
+
+  printf("percentile_stream: %d frames of %d x %d pixels, %d bins\n",
+         n_windows, window, NPPC, 1 << BIN_BITS);
+
+  for (int k = 0; k < N_PERCENTILES; k++)
+    q[k] = fractions[k];
+  for (int w = 0; w < n_windows; w++) {
+    for (int i = 0; i < window; i++) {
+      vec<pixel_t, NPPC> v;
+      for (int l = 0; l < NPPC; l++) {
+        int p = test_pixel(w, i * NPPC + l);
+        v[l] = p;
+        frames[w].push_back(p);
+      }
+      in.write(v);
+    }
+  }
+
+  percentile_stream_wrapper(in, out, q, window, n_windows);
+
+  for (int w = 0; w < n_windows; w++) {
+    vec<pixel_t, N_PERCENTILES> r = out.read();
+    std::vector<int> sorted = frames[w];
+    std::sort(sorted.begin(), sorted.end());
+    for (int k = 0; k < N_PERCENTILES; k++) {
+      int rank = std::max(1, (int)ceil((double)q[k] * sorted.size()));
+      int expect = sorted[rank - 1];
+      int got = (int)r[k];
+      if (got > expect || expect - got >= bin_width) {
+        printf("frame %d: p%.2f = %d, expected %d\n", w, fractions[k], got, expect);
+        wrong++;
+      }
+      count++;
+    }
+  }
+
+  printf("percentile_stream: Count: %d\tWrong: %d\n\n", count, wrong);
+  return wrong != 0;
+}
+
+int main() {
+  int RC = 0;
+
+#ifdef COSIM_EARLY_EXIT
+  // ---------------------------------------------------------------------
+  // This test will be used automatically when running cosimulation, as
+  // SmartHLS defines COSIM_EARLY_EXIT when running cosim.
+  // This test is quick, good to validate the generated verilog and see
+  // the wave form
+  // ---------------------------------------------------------------------
+  RC |= test_stats(64, 3);
+
+#else
+  // ---------------------------------------------------------------------
+  // These tests are for software run as they call the HLS module
+  // thousands of times. Good to validate the algorithm and its parameters.
+  // ---------------------------------------------------------------------
+  RC |= test_stats(1920 * 1080 / NPPC, 3);
+  RC |= test_stats(1000, 30);
+  RC |= test_percentiles(1000, 30);
+
+#endif
+
+  if (RC != 0)  printf("Errors may have occurred. Please double-check usage.\n");
+  return RC;
+}
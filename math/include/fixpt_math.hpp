@@ -30,9 +30,17 @@
 #include "hls_cos.hpp"
 #include "hls_tan.hpp"
 #include "hls_sqrt.hpp"
+#include "hls_reciprocal.hpp"
 #include "hls_asin.hpp"
 #include "hls_acos.hpp"
 #include "hls_atan.hpp"
+#include "hls_polar.hpp"
+#include "hls_poly_approx.hpp"
+#include "hls_activation.hpp"
+#include "hls_matrix.hpp"
+#include "hls_qr.hpp"
+#include "hls_minifloat.hpp"
+#include "hls_stats.hpp"
 #include "hls_round.hpp"
 #include "hls_ceil.hpp"
 #include "hls_floor.hpp"
@@ -42,20 +42,17 @@ namespace math {
  * @template {int} IW_IN width of integer portion of the input (automatically inferred)
  *
  * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} num input
- * @param {int} error variable to hold error code value if an error occurs
+ * @param {int|error_status} error variable to hold error code value if an error occurs
  * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} arccosine of input value (in radians)
  * @example
  * hls::ap_fixpt<10, 2> y = 0.707;
  * auto x = hls::math::acos_cordic<10, 2, 16>(y); // x will be an ap_fixpt number with the value 0.785549163 
  */	
-template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
-ap_fixpt<W_OUT, IW_OUT> acos_cordic(ap_fixpt<W_IN, IW_IN> num, int& error = DEFAULT_ERROR) {
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN, typename E>
+ap_fixpt<W_OUT, IW_OUT> acos_cordic(ap_fixpt<W_IN, IW_IN> num, E &error) {
 // Check for Out of Domain error:
   if (num < -1 || num > 1){
-#ifndef __SYNTHESIS__
-    printf("Argument is invalid. Must be within [-1, 1].\n");
-#endif
-    error = NAN_ERROR;
+    report_error(error, NAN_ERROR, "Argument is invalid. Must be within [-1, 1].\n");
     return 0;
   }
   ap_fixpt<W_OUT, IW_OUT> result;
@@ -64,5 +61,11 @@ ap_fixpt<W_OUT, IW_OUT> acos_cordic(ap_fixpt<W_IN, IW_IN> num, int& error = DEFA
 
   return result;
 }
+
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> acos_cordic(ap_fixpt<W_IN, IW_IN> num) {
+  ignore_error error;
+  return acos_cordic<W_OUT, IW_OUT, N_ITERATIONS>(num, error);
+}
 } // namespace math
 } // namespace hls
@@ -0,0 +1,206 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#pragma once
+#include <cmath>
+#include "hls_common.hpp"
+#include "hls_exp.hpp"
+#include "hls_reciprocal.hpp"
+#include "hls_poly_approx.hpp"
+
+/***
+ * @title activation
+ */
+
+namespace hls {
+namespace math {
+
+// Reference functions used to build the activation tables at compile time.
+struct sigmoid_f {
+  double operator()(double x) const { return 1 / (1 + std::exp(-x)); }
+};
+struct tanh_f {
+  double operator()(double x) const { return std::tanh(x); }
+};
+struct gelu_f {
+  double operator()(double x) const { return 0.5 * x * (1 + std::erf(x / std::sqrt(2.0))); }
+};
+
+// All three tables use 128 segments of degree 2, which keeps the error of the
+// table itself around 2^-17 (see poly_segment_bits). Beyond the table range
+// the functions are saturated; the error of doing so is below 2^-21.
+const int ACTIVATION_SEGMENT_BITS = 7;
+const int ACTIVATION_DEGREE = 2;
+
+/***
+ * @function sigmoid
+ * Table-based implementation of the logistic sigmoid, 1 / (1 + e^-x).
+ *
+ * A piecewise-quadratic table covers [0, 16) and negative inputs use
+ * sigmoid(-x) = 1 - sigmoid(x). For |x| >= 16 the output saturates.
+ * There are no data-dependent loops, so the function can be pipelined with II=1.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x input
+ * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} sigmoid of the input value
+ * @example
+ * hls::ap_fixpt<16, 4> y = 1;
+ * auto x = hls::math::sigmoid<16, 2>(y); //x will be an ap_fixpt w/ the value 0.731018
+ */
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> sigmoid(ap_fixpt<W_IN, IW_IN> x) {
+  static const piecewise_poly<sigmoid_f, 0, 4, ACTIVATION_SEGMENT_BITS, ACTIVATION_DEGREE, 24, 2> table;
+  typedef ap_fixpt<W_OUT + 2, 2> T;
+
+  bool neg = x < 0;
+  ap_ufixpt<W_IN, IW_IN> ax = neg ? ap_fixpt<W_IN + 1, IW_IN + 1>(-x) : ap_fixpt<W_IN + 1, IW_IN + 1>(x);
+  T y = (ax >= 16) ? T(1) : table.template eval<W_OUT + 2, 2>(ap_fixpt<W_IN + 1, IW_IN + 1>(ax));
+  if (neg)
+    y = T(1) - y;
+  return y;
+}
+
+/***
+ * @function tanh
+ * Table-based implementation of tanh.
+ *
+ * A piecewise-quadratic table covers [0, 8) and negative inputs use
+ * tanh(-x) = -tanh(x). For |x| >= 8 the output saturates.
+ * There are no data-dependent loops, so the function can be pipelined with II=1.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x input
+ * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} hyperbolic tangent of the input value
+ * @example
+ * hls::ap_fixpt<16, 4> y = 1;
+ * auto x = hls::math::tanh<16, 2>(y); //x will be an ap_fixpt w/ the value 0.761536
+ */
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> tanh(ap_fixpt<W_IN, IW_IN> x) {
+  static const piecewise_poly<tanh_f, 0, 3, ACTIVATION_SEGMENT_BITS, ACTIVATION_DEGREE, 24, 2> table;
+  typedef ap_fixpt<W_OUT + 2, 2> T;
+
+  bool neg = x < 0;
+  ap_ufixpt<W_IN, IW_IN> ax = neg ? ap_fixpt<W_IN + 1, IW_IN + 1>(-x) : ap_fixpt<W_IN + 1, IW_IN + 1>(x);
+  T y = (ax >= 8) ? T(1) : table.template eval<W_OUT + 2, 2>(ap_fixpt<W_IN + 1, IW_IN + 1>(ax));
+  if (neg)
+    y = -y;
+  return y;
+}
+
+/***
+ * @function gelu
+ * Table-based implementation of the Gaussian error linear unit, x * Phi(x),
+ * where Phi is the standard normal cumulative distribution function.
+ *
+ * A piecewise-quadratic table covers [0, 8) and negative inputs use
+ * gelu(-x) = gelu(x) - x. For x >= 8 the output is x and for x <= -8 it is 0.
+ * There are no data-dependent loops, so the function can be pipelined with II=1.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x input
+ * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} GELU of the input value
+ * @example
+ * hls::ap_fixpt<16, 4> y = 1;
+ * auto x = hls::math::gelu<16, 4>(y); //x will be an ap_fixpt w/ the value 0.841309
+ */
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> gelu(ap_fixpt<W_IN, IW_IN> x) {
+  static const piecewise_poly<gelu_f, 0, 3, ACTIVATION_SEGMENT_BITS, ACTIVATION_DEGREE, 24, 5> table;
+  const int IW_T = (IW_IN + 1 > 5) ? IW_IN + 1 : 5;
+  typedef ap_fixpt<W_OUT - IW_OUT + IW_T, IW_T> T;
+
+  bool neg = x < 0;
+  ap_ufixpt<W_IN, IW_IN> ax = neg ? ap_fixpt<W_IN + 1, IW_IN + 1>(-x) : ap_fixpt<W_IN + 1, IW_IN + 1>(x);
+  T y = (ax >= 8) ? T(ax) : table.template eval<W_OUT - IW_OUT + IW_T, IW_T>(ap_fixpt<W_IN + 1, IW_IN + 1>(ax));
+  if (neg)
+    y = y - T(ax);
+  return y;
+}
+
+/***
+ * @function softmax
+ * Softmax over a vector of N values, out[i] = e^(in[i] - max) / sum(e^(in[j] - max)).
+ *
+ * The vector is processed in three pipelined passes: find the maximum, compute
+ * the exponentials and their sum, then scale by a single reciprocal of the
+ * sum. Subtracting the maximum keeps every exponential in (0, 1], so the
+ * exponentials never overflow, and using one reciprocal avoids a divider per
+ * element.
+ *
+ * @template {int} N number of elements
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>[N]} in input vector
+ * @param {ap_ufixpt<unsigned int W_OUT, int IW_OUT>[N]} out output vector, sums to 1
+ * @example
+ * hls::ap_fixpt<16, 6> in[3] = {1, 2, 3};
+ * hls::ap_ufixpt<16, 1> out[3];
+ * hls::math::softmax<3>(in, out); //out will hold 0.090027, 0.244720, 0.665222
+ */
+template <int N, unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+void softmax(ap_fixpt<W_IN, IW_IN> in[N], ap_ufixpt<W_OUT, IW_OUT> out[N]) {
+  // e^(x - max) is in (0, 1]; keep a few more fractional bits than the output.
+  typedef ap_fixpt<W_OUT - IW_OUT + 6, 2> E;
+  const int N_BITS = bit_width(N);
+  typedef ap_ufixpt<W_OUT - IW_OUT + 4 + N_BITS, N_BITS + 1> S;
+
+  ap_fixpt<W_IN, IW_IN> max = in[0];
+#pragma HLS loop pipeline
+  for (int i = 1; i < N; i++) {
+    if (in[i] > max)
+      max = in[i];
+  }
+
+  E e[N];
+  S sum = 0;
+#pragma HLS loop pipeline
+  for (int i = 0; i < N; i++) {
+    ap_fixpt<W_IN + 1, IW_IN + 1> d = in[i] - max;
+    e[i] = exp_lut<W_OUT - IW_OUT + 6, 2>(d);
+    sum += ap_ufixpt<W_OUT - IW_OUT + 6, 2>(e[i]);
+  }
+
+  // sum >= 1 because the maximum element contributes e^0.
+  ap_ufixpt<W_OUT - IW_OUT + 4, 1> inv = reciprocal<W_OUT - IW_OUT + 4, 1, 2>(sum);
+  DBG_CODE{ printf("max = %f, sum = %f, 1/sum = %f\n", (double)max, (double)sum, (double)inv); }
+
+#pragma HLS loop pipeline
+  for (int i = 0; i < N; i++) {
+    out[i] = ap_ufixpt<W_OUT - IW_OUT + 6, 2>(e[i]) * inv;
+  }
+}
+} // namespace math
+} // namespace hls
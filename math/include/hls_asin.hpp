@@ -42,22 +42,19 @@ namespace math {
  * @template {int} IW_IN width of integer portion of the input (automatically inferred)
  *
  * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} num input
- * @param {int} error variable to hold error code value if an error occurs
+ * @param {int|error_status} error variable to hold error code value if an error occurs
  * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} arcsine of input value (in radians)
  * @example
  * hls::ap_fixpt<10, 2> y = 0.707;
  * auto x = hls::math::asin_cordic<10, 2, 16>(y); // x will be an ap_fixpt number with the value 0.785247163 
  */
 
-template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
-ap_fixpt<W_OUT, IW_OUT> asin_cordic(ap_fixpt<W_IN, IW_IN> num, int& error = DEFAULT_ERROR) {
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN, typename E>
+ap_fixpt<W_OUT, IW_OUT> asin_cordic(ap_fixpt<W_IN, IW_IN> num, E &error) {
 
 // Check for Out of Domain error:
   if (num < -1 || num > 1){
-#ifndef __SYNTHESIS__
-    printf("Argument is invalid. Must be within [-1, 1].\n");
-#endif 
-    error = NAN_ERROR;
+    report_error(error, NAN_ERROR, "Argument is invalid. Must be within [-1, 1].\n");
     return 0;
   }
   
@@ -69,5 +66,11 @@ ap_fixpt<W_OUT, IW_OUT> asin_cordic(ap_fixpt<W_IN, IW_IN> num, int& error = DEFA
   cordic<N_ITERATIONS>(angle, x, y, num);
   return -angle;
 }
+
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> asin_cordic(ap_fixpt<W_IN, IW_IN> num) {
+  ignore_error error;
+  return asin_cordic<W_OUT, IW_OUT, N_ITERATIONS>(num, error);
+}
 } // namespace math
 } // namespace hls
@@ -15,5 +15,38 @@ namespace math{
 
 constexpr int VECTORING = 1;
 constexpr int ROTATING = 0;
+
+// Number of bits needed to represent n, i.e. floor(log2(n)) + 1.
+constexpr unsigned int bit_width(unsigned int n) {
+  return n == 0 ? 0 : 1 + bit_width(n >> 1);
+}
+
+/***
+ * @function lzc_normalize
+ * Shifts x left until its most significant bit is set and returns the number
+ * of leading zeros that were removed. The count is built as a log2(W)-deep
+ * tree of shift stages (16, 8, 4, 2, 1 for 32 bits) instead of a W-long
+ * bit-serial loop, so it has a short, fixed latency.
+ *
+ * x must be non-zero.
+ *
+ * @template {unsigned int} W width of the input (automatically inferred)
+ *
+ * @param {ap_uint<W>} x value to normalise, will hold the normalised value
+ * @return {unsigned int} number of leading zeros of the original value
+ */
+template <unsigned int W>
+unsigned int lzc_normalize(ap_uint<W> &x) {
+  unsigned int count = 0;
+#pragma HLS loop unroll
+  for (int k = bit_width(W - 1) - 1; k >= 0; k--) {
+    const unsigned int step = 1u << k;
+    if ((x >> (W - step)) == 0) {
+      x <<= step;
+      count += step;
+    }
+  }
+  return count;
+}
 }
 }
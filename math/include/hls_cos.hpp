@@ -82,8 +82,10 @@ ap_fixpt<W_OUT, IW_OUT> cos_cordic(ap_fixpt<W_IN, IW_IN> x) {
  */
 template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
 ap_fixpt<W_OUT, IW_OUT> cos_taylor(ap_fixpt<W_IN, IW_IN> x) {
-  ap_fixpt<W_OUT, IW_OUT> HALF_PI(M_PI_2);
-  return (sin_taylor<W_OUT, IW_OUT>(HALF_PI - x));
+  // cos(x) = sin(x + pi/2), which moves x to the next quadrant.
+  ap_uint<2> q;
+  ap_ufixpt<W_OUT - IW_OUT + 1, 1> r = reduce_quadrant<W_OUT - IW_OUT + 1>(x, q);
+  return sin_taylor_quadrant<W_OUT, IW_OUT>(r, ap_uint<2>(q + 1));
 }
 
 /***
@@ -105,8 +107,10 @@ ap_fixpt<W_OUT, IW_OUT> cos_taylor(ap_fixpt<W_IN, IW_IN> x) {
  */
 template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
 ap_fixpt<W_OUT, IW_OUT> cos_lut(ap_fixpt<W_IN, IW_IN> x) {
-  ap_fixpt<W_IN, IW_IN> HALF_PI(M_PI_2);
-  return (sin_lut<W_OUT, IW_OUT>(HALF_PI - x));
+  // cos(x) = sin(x + pi/2), which moves x to the next quadrant.
+  ap_uint<2> q;
+  ap_ufixpt<SIN_LUT_W_R, 1> r = reduce_quadrant<SIN_LUT_W_R>(x, q);
+  return sin_lut_quadrant<W_OUT, IW_OUT>(r, ap_uint<2>(q + 1));
 }
 } //namespace math
 } // namespace hls
@@ -18,11 +18,67 @@
 // https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
 // TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
 #pragma once
+#include <cstdio>
 
 namespace hls {
 namespace math {	
-static int DEFAULT_ERROR = 0; /**< Error variables in applicable functions are set to this by default to indicate no error. */
+static int DEFAULT_ERROR = 0; /**< No error. An int error variable is only written when an error occurs, so initialise it to this. */
 static int NAN_ERROR = 1; /**< Result is not a number (e.\g.\ complex). */
 static int INF_ERROR = 2;/**< Result is +/-infinity. */
+
+/**
+ * Functions that can fail take the place to report the error to as their last
+ * argument. It can be:
+ * - an int, which is set to NAN_ERROR or INF_ERROR.
+ * - an error_status, which keeps sticky flags and a count of the errors.
+ * Without that argument the function does not report errors at all, so it has
+ * no side effects and can be used in a pipelined loop without a dependency
+ * between iterations.
+ */
+
+/**
+ * Sticky error status, e.g. one per stream or per loop. The flags stay set
+ * until clear() is called and count is the number of errors since then.
+ */
+struct error_status {
+  bool nan;
+  bool inf;
+  unsigned int count;
+
+  error_status() : nan(false), inf(false), count(0) {}
+
+  void set(int code) {
+    if (code == NAN_ERROR)
+      nan = true;
+    else if (code == INF_ERROR)
+      inf = true;
+    count++;
+  }
+  bool ok() const { return count == 0; }
+  void clear() {
+    nan = false;
+    inf = false;
+    count = 0;
+  }
+};
+
+/** Error sink used when the caller does not pass one; errors are dropped. */
+struct ignore_error {};
+
+inline void report_error(int &error, int code, const char *msg) {
+#ifndef __SYNTHESIS__
+  printf("%s", msg);
+#endif
+  error = code;
+}
+
+inline void report_error(error_status &status, int code, const char *msg) {
+#ifndef __SYNTHESIS__
+  printf("%s", msg);
+#endif
+  status.set(code);
+}
+
+inline void report_error(ignore_error &, int, const char *) {}
 }
 }
@@ -22,6 +22,7 @@
 // Released under BSD license. To see full license, see licenses folder in fixptc_license.
 
 #pragma once
+#include <cmath>
 #include "hls_common.hpp"
 #include "hls_cordic.hpp"
 
@@ -192,5 +193,121 @@ ap_fixpt<W_OUT, IW_OUT> exp_cordic(ap_fixpt<W_IN, IW_IN> fp) {
   DBG_CODE { printf("cordic result = %f\n\n", (double)result); }
  return result;
 }
+
+// Number of bits of the fraction that index the 2^f table of exp2_lut.
+const int EXP2_LUT_TABLE_BITS = 8;
+
+// 2^(i / 2^TABLE_BITS) for every i, in [1, 2), and the Taylor coefficients of
+// 2^(u / 2^TABLE_BITS) - 1 in u, (ln2 / 2^TABLE_BITS)^k / k!. Built by the
+// constructor, so a static const instance becomes a ROM, as with piecewise_poly.
+template <int TABLE_BITS, unsigned int W_T> struct exp2_table {
+  ap_ufixpt<W_T + 1, 1> pow2[1 << TABLE_BITS];
+  ap_ufixpt<W_T, 0> coeff[6];
+
+  exp2_table() {
+    for (int i = 0; i < (1 << TABLE_BITS); i++)
+      pow2[i] = (double)std::exp2((long double)i / (1 << TABLE_BITS));
+    long double c = 1;
+    for (int k = 0; k < 6; k++) {
+      coeff[k] = (double)c;
+      c *= 0.693147180559945309417232121458L / (1 << TABLE_BITS) / (k + 1);
+    }
+  }
+};
+
+/***
+ * @function exp2_lut
+ * Table-based implementation of 2^x.
+ *
+ * x is split into its integer part k and its fraction f = f_hi + f_lo, where
+ * f_hi is the top EXP2_LUT_TABLE_BITS bits of f. 2^f_hi is read from a table
+ * and 2^f_lo, with f_lo < 2^-EXP2_LUT_TABLE_BITS, is a short polynomial (the
+ * degree grows with W_OUT, from 1 up to 5). 2^k is a single shift. There is no
+ * long multiply chain or loop, so it pipelines with II=1. Results beyond the
+ * range of the output saturate.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x input
+ * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} 2 raised to the power of the input
+ * @example
+ * hls::ap_fixpt<16, 4> y = 2.5;
+ * auto x = hls::math::exp2_lut<16, 4>(y); //x will be an ap_fixpt w/ the value 5.656738 (2^2.5 = 5.656854)
+ */
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> exp2_lut(ap_fixpt<W_IN, IW_IN> x) {
+  const int K = EXP2_LUT_TABLE_BITS;
+  // 2^f is kept with 4 more fractional bits than the output width, so that
+  // even the largest results keep all their output bits.
+  const int F_M = W_OUT + 4;
+  // Smallest degree whose truncation error, (ln2 * 2^-K)^(d + 1) / (d + 1)!,
+  // is below 2^-F_M: about 2^-18, 2^-28, 2^-38 and 2^-49 for d = 1 to 4.
+  const int DEG = (F_M <= 18) ? 1 : (F_M <= 28) ? 2 : (F_M <= 38) ? 3 : (F_M <= 49) ? 4 : 5;
+  static const exp2_table<K, F_M> table;
+
+  // Make sure the fraction has at least one bit below the table index.
+  const int F_IN = (int)W_IN - IW_IN;
+  const int F_X = (F_IN > K) ? F_IN : K + 1;
+  ap_fixpt<IW_IN + F_X, IW_IN> xf = x;
+  ap_int<IW_IN> k = xf(IW_IN + F_X - 1, F_X);
+  ap_uint<K> f_hi = xf(F_X - 1, F_X - K);
+  ap_ufixpt<F_X - K, 0> u;
+  u(F_X - K - 1, 0) = xf(F_X - K - 1, 0);
+  DBG_CODE{ printf("x = %f, k = %d, f_hi = %d, u = %f\n", (double)x, (int)k.to_int64(), (int)f_hi.to_uint64(), (double)u); }
+
+  // p = 2^f_lo - 1 by Horner's rule.
+  ap_ufixpt<F_M, 0> p = table.coeff[DEG];
+#pragma HLS loop unroll
+  for (int d = DEG - 1; d >= 1; d--)
+    p = p * u + table.coeff[d];
+  p = p * u;
+
+  ap_ufixpt<F_M + 1, 1> t = table.pow2[f_hi];
+  ap_ufixpt<F_M + 1, 1> m = t + t * p;
+  DBG_CODE{ printf("2^f = %f\n", (double)m); }
+
+  // m * 2^k: shifted all the way left first, then right by the clamped amount,
+  // so there is a single barrel shifter. Beyond the clamps the result is 0 or
+  // saturates.
+  const int SH_L = IW_OUT - 1;
+  const int SH_MAX = SH_L + (W_OUT - IW_OUT) + 2;
+  int sh = SH_L - (int)k.to_int64();
+  if (sh < 0)
+    sh = 0;
+  if (sh > SH_MAX)
+    sh = SH_MAX;
+  ap_ufixpt<F_M + 1 + SH_L, 1 + SH_L> z = m;
+  z <<= SH_L;
+  z >>= sh;
+  ap_fixpt<W_OUT, IW_OUT, AP_RND, AP_SAT> result = z;
+  return result;
+}
+
+/***
+ * @function exp_lut
+ * Table-based implementation of exp, computed as exp2_lut(x * log2(e)).
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x input
+ * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} e raised to the power of the input
+ * @example
+ * hls::ap_fixpt<10, 2> y = 1;
+ * auto x = hls::math::exp_lut<10, 3>(y); //x will be an ap_fixpt w/ the value 2.71875
+ */
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> exp_lut(ap_fixpt<W_IN, IW_IN> x) {
+  // The error of t is multiplied by up to 2^(IW_OUT - 1) in the result, so
+  // log2(e) and t get a few guard bits, plus IW_IN for the size of x.
+  const ap_ufixpt<W_OUT + 4 + IW_IN, 1> LOG2E(M_LOG2E);
+  ap_fixpt<IW_IN + 1 + W_OUT + 4, IW_IN + 1> t = x * LOG2E;
+  return exp2_lut<W_OUT, IW_OUT>(t);
+}
 } // namespace math
 } // namespace hls
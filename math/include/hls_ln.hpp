@@ -42,21 +42,27 @@ namespace math {
  * @template {int} IW_IN width of integer portion of the input (automatically inferred)
  *
  * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} num input
- * @param {int} error variable to hold error code value if an error occurs
+ * @param {int|error_status} error variable to hold error code value if an error occurs
  * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} natural logarithm of the input value
  * @example
  * hls::ap_fixpt<10, 2> y = 2;
  * auto x = hls::math::ln_lut<10, 2>(y); //x will be an ap_fixpt w/ the value 0.69314718055995
  */
-template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
-ap_fixpt<W_OUT, IW_OUT> ln_lut(ap_ufixpt<W_IN, IW_IN> x, int& error = DEFAULT_ERROR) {
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN, typename E>
+ap_fixpt<W_OUT, IW_OUT> ln_lut(ap_ufixpt<W_IN, IW_IN> x, E &error) {
   // CONV_FACTOR = 1/log_2(e)
   const ap_ufixpt<W_IN + 1, 0> CONV_FACTOR(1/M_LOG2E);
-  ap_fixpt<W_OUT, IW_OUT> log2_x = log2_lut<W_OUT, IW_OUT>(x);
+  ap_fixpt<W_OUT, IW_OUT> log2_x = log2_lut<W_OUT, IW_OUT>(x, error);
   ap_fixpt<W_OUT, IW_OUT, AP_RND> result = CONV_FACTOR * log2_x;
   return result;
 }
 
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> ln_lut(ap_ufixpt<W_IN, IW_IN> x) {
+  ignore_error error;
+  return ln_lut<W_OUT, IW_OUT>(x, error);
+}
+
 /***
  * @function ln_cordic
  * CORDIC based implementation of ln. Uses the lookup implementation of log2. If the input is negative, then an error will occur.
@@ -68,19 +74,25 @@ ap_fixpt<W_OUT, IW_OUT> ln_lut(ap_ufixpt<W_IN, IW_IN> x, int& error = DEFAULT_ER
  * @template {int} IW_IN width of integer portion of the input (automatically inferred)
  *
  * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} num input
- * @param {int} error variable to hold error code value if an error occurs
+ * @param {int|error_status} error variable to hold error code value if an error occurs
  * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} natural logarithm of the input value
  * @example
  * hls::ap_fixpt<10, 2> y = 2;
  * auto x = hls::math::ln_cordic<10, 2, 16>(y); //x will be an ap_fixpt w/ the value 0.69314718055995
  */
-template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
-ap_fixpt<W_OUT, IW_OUT> ln_cordic(ap_ufixpt<W_IN, IW_IN> x, int& error = DEFAULT_ERROR) {
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN, typename E>
+ap_fixpt<W_OUT, IW_OUT> ln_cordic(ap_ufixpt<W_IN, IW_IN> x, E &error) {
   // CONV_FACTOR = 1/log_2(e)
   const ap_ufixpt<W_IN + 1, 0> CONV_FACTOR(1/M_LOG2E);
-  ap_fixpt<W_OUT, IW_OUT> log2_x = log2_cordic<W_OUT, IW_OUT, N_ITERATIONS>(x);
+  ap_fixpt<W_OUT, IW_OUT> log2_x = log2_cordic<W_OUT, IW_OUT, N_ITERATIONS>(x, error);
   ap_fixpt<W_OUT, IW_OUT, AP_RND> result = CONV_FACTOR * log2_x;
   return result;
 }
+
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> ln_cordic(ap_ufixpt<W_IN, IW_IN> x) {
+  ignore_error error;
+  return ln_cordic<W_OUT, IW_OUT, N_ITERATIONS>(x, error);
+}
 } // namespace math
 } // namespace hls
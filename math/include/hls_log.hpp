@@ -44,31 +44,25 @@ namespace math {
  *
  * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x input
  * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} base log base
- * @param {int} error variable to hold error code value if an error occurs
+ * @param {int|error_status} error variable to hold error code value if an error occurs
  * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} log of input value with base
  * @example
  * hls::ap_fixpt<10, 2> y = 4;
  * hls::ap_fixpt<10, 3> base = 2;
  * auto x = hls::math::log<10, 2>(y, base); //x will be an ap_fixpt w/ the value 2
  */
-template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN, typename E>
 ap_fixpt<W_OUT, IW_OUT> log(ap_ufixpt<W_IN, IW_IN> x,
                              ap_ufixpt<W_IN, IW_IN> base,
-			     int& error = DEFAULT_ERROR) {
+			     E &error) {
 
   if (x < 0 || base <= 0) {
-#ifndef __SYNTHESIS__
-    printf("Math Error: argument cannot be negative/base cannot be 0.\n");
-#endif
-    error = NAN_ERROR;
+    report_error(error, NAN_ERROR, "Math Error: argument cannot be negative/base cannot be 0.\n");
     return (0);
   }
 
   if (x == 0) {
-#ifndef __SYNTHESIS__
-    printf("Math Error: result is -inf.\n");
-#endif
-    error = INF_ERROR;
+    report_error(error, INF_ERROR, "Math Error: result is -inf.\n");
     return (0);
   }
 
@@ -77,5 +71,12 @@ ap_fixpt<W_OUT, IW_OUT> log(ap_ufixpt<W_IN, IW_IN> x,
   return (log2_lut<W_OUT, IW_OUT>(x) /
           log2_lut<W_OUT, IW_OUT>(base));
 }
+
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> log(ap_ufixpt<W_IN, IW_IN> x,
+                             ap_ufixpt<W_IN, IW_IN> base) {
+  ignore_error error;
+  return log<W_OUT, IW_OUT>(x, base, error);
+}
 } // namespace math
 } // namespace hls
@@ -30,6 +30,21 @@
 namespace hls {
 namespace math {
 
+// Splits a non-zero x into x_normal * 2^j with x_normal in [0.5, 1) and
+// returns j. Uses the lzc_normalize tree, so there is no W_IN-long shifting
+// loop and no variable shift. x_normal only has W_IN - 1 fractional bits, so
+// the last bit of the normalised mantissa is truncated.
+template <unsigned int W_IN, int IW_IN>
+int log2_normalize(ap_ufixpt<W_IN, IW_IN> x, ap_fixpt<W_IN, 1> &x_normal) {
+  ap_uint<W_IN> mant = x(W_IN - 1, 0);
+  int lz = lzc_normalize<W_IN>(mant);
+  ap_ufixpt<W_IN, 0> m;
+  m(W_IN - 1, 0) = mant;
+  x_normal = m;
+  DBG_CODE{ printf("x_normal = %f, j = %d\n", (double)x_normal, IW_IN - lz);}
+  return IW_IN - lz;
+}
+
 // Algorithm adapted from https://www.researchgate.net/profile/Salvador-Tropea/publication/4254293_FPGA_implementation_of_base-N_logarithm/links/564cb22d08aedda4c134385a/FPGA-implementation-of-base-N-logarithm.pdf
 // Modified: Made compilable with SHLS.
 
@@ -43,45 +58,29 @@ namespace math {
  * @template {int} IW_IN width of integer portion of the input (automatically inferred)
  *
  * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} num input
- * @param {int} error variable to hold error code value if an error occurs
+ * @param {int|error_status} error variable to hold error code value if an error occurs
  * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} log2 of input value
  * @example
  * hls::ap_fixpt<10, 2> y = 4;
  * auto x = hls::math::log2_lut<10, 2>(y); //x will be an ap_fixpt w/ the value 2
  */
-template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
-ap_fixpt<W_OUT, IW_OUT> log2_lut(ap_ufixpt<W_IN, IW_IN> x, int& error = DEFAULT_ERROR) {
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN, typename E>
+ap_fixpt<W_OUT, IW_OUT> log2_lut(ap_ufixpt<W_IN, IW_IN> x, E &error) {
 
   if (x == 0) {
-#ifndef __SYNTHESIS__
-    printf("Math Error: result is -inf.\n");
-#endif
-    error = INF_ERROR;
+    report_error(error, INF_ERROR, "Math Error: result is -inf.\n");
     return (0);
   }
   else if (x == 1) return 0;
   else if (x == 2) return 1;
 // IW_IN MUST BE LARGER THAN 2
-  // Find j:
-  int n = W_IN - 1;
-  int j = IW_IN, done = 0;
+  // Find j, x = x_normal * 2^j with x_normal in [0.5, 1):
   DBG_CODE{ printf("x = %f\n", (double)x);}
-
-   auto xi = x;
-  for (unsigned int i = 0; i < n; i ++){
-        if (xi[W_IN - 1] == 1) done = 1;
-        if (done == 0){
-                xi <<= 1;
-                j --;
-        }
- DBG_CODE{ printf("x = %f, j = %d\n", (double)xi, j);}
-  }
-
   ap_fixpt<W_IN, 1> x_normal;
-  if (j > 0) x_normal = x >> j;
-  else x_normal = x << -(j);
+  int j = log2_normalize(x, x_normal);
   ap_fixpt<W_OUT, IW_OUT> y = 0;
-  ap_fixpt<W_IN, IW_IN> x2;
+  // x2 < 2, and it keeps every fraction bit of x_normal.
+  ap_fixpt<W_IN + 1, 2> x2;
 
   // See paper for why W_OUT - 3
   const unsigned int n2 = (W_OUT - 3 > LOG_TABLE_SIZE) ? LOG_TABLE_SIZE : W_OUT - 3;
@@ -94,11 +93,21 @@ ap_fixpt<W_OUT, IW_OUT> log2_lut(ap_ufixpt<W_IN, IW_IN> x, int& error = DEFAULT_
         }
    DBG_CODE{printf("tab_i = %f, x = %f, y = %f\n", (double)((ap_fixpt<31,0>)logTable[i]), (double)x_normal, (double)y);}
   }
+  // x_normal is now within 2^-(n2 - 2) of 1, so log2(x_normal) is close to
+  // (x_normal - 1) * log2(e). Adding it covers the table entries past n2.
+  const ap_ufixpt<W_OUT, 1> LOG2_E(M_LOG2E);
+  y = y + (x_normal - 1) * LOG2_E;
   y = y + j;
   DBG_CODE{printf("y + j = %f\n", (double)y);}
   return y;
 }
 
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> log2_lut(ap_ufixpt<W_IN, IW_IN> x) {
+  ignore_error error;
+  return log2_lut<W_OUT, IW_OUT>(x, error);
+}
+
 // Adapted from http://www.ijsps.com/uploadfile/2014/1210/20141210051242629.pdf
 /***
  * @function log2_cordic
@@ -111,45 +120,27 @@ ap_fixpt<W_OUT, IW_OUT> log2_lut(ap_ufixpt<W_IN, IW_IN> x, int& error = DEFAULT_
  * @template {int} IW_IN width of integer portion of the input (automatically inferred)
  *
  * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} num input
- * @param {int} error variable to hold error code value if an error occurs
+ * @param {int|error_status} error variable to hold error code value if an error occurs
  * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} log2 of input value
  * @example
  * hls::ap_fixpt<10, 2> y = 4;
  * auto x = hls::math::log2_cordic<10, 2, 16>(y); //x will be an ap_fixpt w/ the value 2
  */
-template <unsigned int W_OUT, int IW_OUT, unsigned int N_ITERATIONS, unsigned int W_IN, int IW_IN>
-ap_fixpt<W_OUT, IW_OUT> log2_cordic(ap_ufixpt<W_IN, IW_IN> x, int& error = DEFAULT_ERROR) {
+template <unsigned int W_OUT, int IW_OUT, unsigned int N_ITERATIONS, unsigned int W_IN, int IW_IN, typename E>
+ap_fixpt<W_OUT, IW_OUT> log2_cordic(ap_ufixpt<W_IN, IW_IN> x, E &error) {
 
   if (x == 0) {
-#ifndef __SYNTHESIS__
-    printf("Math Error: result is -inf.\n");
-#endif
-    error = INF_ERROR;
+    report_error(error, INF_ERROR, "Math Error: result is -inf.\n");
     return (0);
   }
   else if (x == 1) return 0;
   else if (x == 2) return 1;
 // IW_IN MUST BE LARGER THAN 2
   const ap_fixpt<W_OUT, 2> CONV(1/M_LN2);
-  // Find j:
-  const int n = W_IN - 1;
-  int j = IW_IN, done = 0;
+  // Find j, x = x_normal * 2^j with x_normal in [0.5, 1):
   DBG_CODE{ printf("x = %f\n", (double)x);}
-
-  auto xi = x;
-#pragma HLS loop unroll factor(W_IN - 1)
-  for (unsigned int i = 0; i < n; i ++){
-        if (xi[W_IN - 1] == 1) done = 1;
-        if (done == 0){
-                xi <<= 1;
-                j --;
-        }
- DBG_CODE{ printf("x = %f, j = %d\n", (double)xi, j);}
-  }
-
   ap_fixpt<W_IN, 1> x_normal;
-  if (j > 0) x_normal = x >> j;
-  else x_normal = x << -(j);
+  int j = log2_normalize(x, x_normal);
 
   ap_fixpt<W_OUT, IW_OUT> x2(x_normal+1);
   ap_fixpt<W_OUT, IW_OUT> y(x_normal-1);
@@ -164,5 +155,11 @@ ap_fixpt<W_OUT, IW_OUT> log2_cordic(ap_ufixpt<W_IN, IW_IN> x, int& error = DEFAU
   DBG_CODE{printf("z + j = %f\n", (double)z);}
   return z;
 }
+
+template <unsigned int W_OUT, int IW_OUT, unsigned int N_ITERATIONS, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> log2_cordic(ap_ufixpt<W_IN, IW_IN> x) {
+  ignore_error error;
+  return log2_cordic<W_OUT, IW_OUT, N_ITERATIONS>(x, error);
+}
 } // namespace math
 } // namespace hls
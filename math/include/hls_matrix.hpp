@@ -0,0 +1,446 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#pragma once
+#include "hls_common.hpp"
+#include "hls_reciprocal.hpp"
+#include "hls/streaming.hpp"
+
+/***
+ * @title matrix
+ */
+
+namespace hls {
+namespace math {
+
+/***
+ * @function matrix
+ * Compile-time sized ROWS x COLS matrix. Partition it completely (e.g.
+ * `#pragma HLS memory partition variable(m) type(complete)`) to use it with
+ * the unrolled kernels below.
+ *
+ * @template {typename} T element type
+ * @template {int} ROWS number of rows
+ * @template {int} COLS number of columns
+ */
+template <typename T, int ROWS, int COLS> struct matrix {
+  T data[ROWS][COLS];
+
+  T &operator()(int r, int c) { return data[r][c]; }
+  const T &operator()(int r, int c) const { return data[r][c]; }
+};
+
+/***
+ * @function vec
+ * Compile-time sized vector of N elements. A whole vec is one hls::FIFO word
+ * in the streaming kernels.
+ *
+ * @template {typename} T element type
+ * @template {int} N number of elements
+ */
+template <typename T, int N> struct vec {
+  T data[N];
+
+  T &operator[](int i) { return data[i]; }
+  const T &operator[](int i) const { return data[i]; }
+};
+
+// Widths of a sum of N products of ap_fixpt<W_A, IW_A> and ap_fixpt<W_B, IW_B>,
+// which never overflows.
+template <unsigned int W_A, int IW_A, unsigned int W_B, int IW_B, int N>
+struct dot_acc {
+  static const int GROWTH = bit_width(N);
+  static const int W = W_A + W_B + GROWTH;
+  static const int IW = IW_A + IW_B + GROWTH;
+  typedef ap_fixpt<W, IW> type;
+};
+
+/***
+ * @function matvec
+ * Matrix-vector product y = A * x, fully unrolled. Meant for small sizes such
+ * as 3x3 colour-correction matrices or 4x4 and 6x6 control loops. The sum is
+ * kept at full precision and only converted to the output type at the end.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} R number of rows of A (automatically inferred)
+ * @template {int} C number of columns of A (automatically inferred)
+ * @template {unsigned int} W_A width of A (automatically inferred)
+ * @template {int} IW_A width of integer portion of A (automatically inferred)
+ * @template {unsigned int} W_X width of x (automatically inferred)
+ * @template {int} IW_X width of integer portion of x (automatically inferred)
+ *
+ * @param {matrix<ap_fixpt<W_A, IW_A>, R, C>} A matrix
+ * @param {vec<ap_fixpt<W_X, IW_X>, C>} x vector
+ * @return {vec<ap_fixpt<W_OUT, IW_OUT>, R>} A * x
+ * @example
+ * hls::math::matrix<hls::ap_fixpt<16, 4>, 2, 2> A = {{{1, 2}, {3, 4}}};
+ * hls::math::vec<hls::ap_fixpt<16, 8>, 2> x = {{1, -1}};
+ * auto y = hls::math::matvec<16, 8>(A, x); // y will hold -1, -1
+ */
+template <unsigned int W_OUT, int IW_OUT, int R, int C, unsigned int W_A, int IW_A,
+          unsigned int W_X, int IW_X>
+vec<ap_fixpt<W_OUT, IW_OUT>, R> matvec(const matrix<ap_fixpt<W_A, IW_A>, R, C> &A,
+                                       const vec<ap_fixpt<W_X, IW_X>, C> &x) {
+  typedef typename dot_acc<W_A, IW_A, W_X, IW_X, C>::type ACC;
+  vec<ap_fixpt<W_OUT, IW_OUT>, R> y;
+#pragma HLS loop unroll
+  for (int i = 0; i < R; i++) {
+    ACC sum = 0;
+#pragma HLS loop unroll
+    for (int j = 0; j < C; j++)
+      sum += A.data[i][j] * x.data[j];
+    y.data[i] = sum;
+  }
+  return y;
+}
+
+/***
+ * @function matvec
+ * Affine transform y = A * x + b, fully unrolled, e.g. colour correction
+ * with offsets.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} R number of rows of A (automatically inferred)
+ * @template {int} C number of columns of A (automatically inferred)
+ * @template {unsigned int} W_A width of A (automatically inferred)
+ * @template {int} IW_A width of integer portion of A (automatically inferred)
+ * @template {unsigned int} W_X width of x (automatically inferred)
+ * @template {int} IW_X width of integer portion of x (automatically inferred)
+ * @template {unsigned int} W_B width of b (automatically inferred)
+ * @template {int} IW_B width of integer portion of b (automatically inferred)
+ *
+ * @param {matrix<ap_fixpt<W_A, IW_A>, R, C>} A matrix
+ * @param {vec<ap_fixpt<W_X, IW_X>, C>} x vector
+ * @param {vec<ap_fixpt<W_B, IW_B>, R>} b offset
+ * @return {vec<ap_fixpt<W_OUT, IW_OUT>, R>} A * x + b
+ */
+template <unsigned int W_OUT, int IW_OUT, int R, int C, unsigned int W_A, int IW_A,
+          unsigned int W_X, int IW_X, unsigned int W_B, int IW_B>
+vec<ap_fixpt<W_OUT, IW_OUT>, R> matvec(const matrix<ap_fixpt<W_A, IW_A>, R, C> &A,
+                                       const vec<ap_fixpt<W_X, IW_X>, C> &x,
+                                       const vec<ap_fixpt<W_B, IW_B>, R> &b) {
+  typedef typename dot_acc<W_A, IW_A, W_X, IW_X, C + 1>::type ACC;
+  vec<ap_fixpt<W_OUT, IW_OUT>, R> y;
+#pragma HLS loop unroll
+  for (int i = 0; i < R; i++) {
+    ACC sum = b.data[i];
+#pragma HLS loop unroll
+    for (int j = 0; j < C; j++)
+      sum += A.data[i][j] * x.data[j];
+    y.data[i] = sum;
+  }
+  return y;
+}
+
+/***
+ * @function matmul
+ * Matrix product C = A * B, fully unrolled (M * N * K multipliers). Use
+ * gemm_systolic for larger sizes.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} M number of rows of A (automatically inferred)
+ * @template {int} K number of columns of A and rows of B (automatically inferred)
+ * @template {int} N number of columns of B (automatically inferred)
+ * @template {unsigned int} W_A width of A (automatically inferred)
+ * @template {int} IW_A width of integer portion of A (automatically inferred)
+ * @template {unsigned int} W_B width of B (automatically inferred)
+ * @template {int} IW_B width of integer portion of B (automatically inferred)
+ *
+ * @param {matrix<ap_fixpt<W_A, IW_A>, M, K>} A left matrix
+ * @param {matrix<ap_fixpt<W_B, IW_B>, K, N>} B right matrix
+ * @return {matrix<ap_fixpt<W_OUT, IW_OUT>, M, N>} A * B
+ */
+template <unsigned int W_OUT, int IW_OUT, int M, int K, int N, unsigned int W_A, int IW_A,
+          unsigned int W_B, int IW_B>
+matrix<ap_fixpt<W_OUT, IW_OUT>, M, N> matmul(const matrix<ap_fixpt<W_A, IW_A>, M, K> &A,
+                                             const matrix<ap_fixpt<W_B, IW_B>, K, N> &B) {
+  typedef typename dot_acc<W_A, IW_A, W_B, IW_B, K>::type ACC;
+  matrix<ap_fixpt<W_OUT, IW_OUT>, M, N> C;
+#pragma HLS loop unroll
+  for (int i = 0; i < M; i++) {
+#pragma HLS loop unroll
+    for (int j = 0; j < N; j++) {
+      ACC sum = 0;
+#pragma HLS loop unroll
+      for (int k = 0; k < K; k++)
+        sum += A.data[i][k] * B.data[k][j];
+      C.data[i][j] = sum;
+    }
+  }
+  return C;
+}
+
+/***
+ * @function transpose
+ * Matrix transpose. Only rewires the elements, so it costs no logic.
+ *
+ * @template {typename} T element type (automatically inferred)
+ * @template {int} R number of rows (automatically inferred)
+ * @template {int} C number of columns (automatically inferred)
+ *
+ * @param {matrix<T, R, C>} A matrix
+ * @return {matrix<T, C, R>} transpose of A
+ */
+template <typename T, int R, int C>
+matrix<T, C, R> transpose(const matrix<T, R, C> &A) {
+  matrix<T, C, R> B;
+#pragma HLS loop unroll
+  for (int i = 0; i < R; i++) {
+#pragma HLS loop unroll
+    for (int j = 0; j < C; j++)
+      B.data[j][i] = A.data[i][j];
+  }
+  return B;
+}
+
+/***
+ * @function homography
+ * Maps the point (x, y) with the 3x3 homography H:
+ * u = (h00 x + h01 y + h02) / w, v = (h10 x + h11 y + h12) / w, with
+ * w = h20 x + h21 y + h22. w is normalised and inverted once with the
+ * table-seeded Newton-Raphson reciprocal and both coordinates reuse the result,
+ * so there is no divider.
+ * If w is 0, then an error will occur and u and v are set to 0.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} N_ITERATIONS number of Newton-Raphson iterations of the reciprocal
+ * @template {unsigned int} W_H width of H (automatically inferred)
+ * @template {int} IW_H width of integer portion of H (automatically inferred)
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {matrix<ap_fixpt<W_H, IW_H>, 3, 3>} H homography
+ * @param {ap_fixpt<W_IN, IW_IN>} x x coordinate
+ * @param {ap_fixpt<W_IN, IW_IN>} y y coordinate
+ * @param {ap_fixpt<W_OUT, IW_OUT>} u mapped x coordinate
+ * @param {ap_fixpt<W_OUT, IW_OUT>} v mapped y coordinate
+ * @param {int|error_status} error variable to hold error code value if an error occurs, optional. See [error](error.md)
+ */
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_H, int IW_H,
+          unsigned int W_IN, int IW_IN, typename E>
+void homography(const matrix<ap_fixpt<W_H, IW_H>, 3, 3> &H, ap_fixpt<W_IN, IW_IN> x,
+                ap_fixpt<W_IN, IW_IN> y, ap_fixpt<W_OUT, IW_OUT> &u,
+                ap_fixpt<W_OUT, IW_OUT> &v, E &error) {
+  typedef dot_acc<W_H, IW_H, W_IN, IW_IN, 3> DOT;
+  typedef ap_ufixpt<DOT::W, DOT::IW> MAG;
+  typename DOT::type p[3];
+#pragma HLS loop unroll
+  for (int i = 0; i < 3; i++)
+    p[i] = H.data[i][0] * x + H.data[i][1] * y + H.data[i][2];
+
+  if (p[2] == 0) {
+    report_error(error, INF_ERROR, "Math Error: homography maps the point to infinity.\n");
+    u = 0;
+    v = 0;
+    return;
+  }
+
+  bool neg_w = p[2] < 0;
+  MAG aw = neg_w ? ap_fixpt<DOT::W + 1, DOT::IW + 1>(-p[2]) : ap_fixpt<DOT::W + 1, DOT::IW + 1>(p[2]);
+  int e;
+  ap_ufixpt<W_OUT + 4, 2> r = reciprocal_normalized<N_ITERATIONS, W_OUT + 4>(aw, e);
+
+  ap_fixpt<W_OUT, IW_OUT> out[2];
+#pragma HLS loop unroll
+  for (int i = 0; i < 2; i++) {
+    bool neg = (p[i] < 0) != neg_w;
+    MAG ap = (p[i] < 0) ? ap_fixpt<DOT::W + 1, DOT::IW + 1>(-p[i]) : ap_fixpt<DOT::W + 1, DOT::IW + 1>(p[i]);
+    ap_ufixpt<DOT::W + W_OUT + 4, DOT::IW + 2> q = ap * r;
+    ap_ufixpt<W_OUT - 1, IW_OUT - 1> m = scale_pow2<W_OUT - 1, IW_OUT - 1, DOT::IW - DOT::W + 1, DOT::IW>(q, e);
+    ap_fixpt<W_OUT, IW_OUT> result = m;
+    out[i] = neg ? ap_fixpt<W_OUT, IW_OUT>(-result) : result;
+  }
+  u = out[0];
+  v = out[1];
+}
+
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_H, int IW_H,
+          unsigned int W_IN, int IW_IN>
+void homography(const matrix<ap_fixpt<W_H, IW_H>, 3, 3> &H, ap_fixpt<W_IN, IW_IN> x,
+                ap_fixpt<W_IN, IW_IN> y, ap_fixpt<W_OUT, IW_OUT> &u,
+                ap_fixpt<W_OUT, IW_OUT> &v) {
+  ignore_error error;
+  homography<W_OUT, IW_OUT, N_ITERATIONS>(H, x, y, u, v, error);
+}
+
+/***
+ * @function matvec_stream
+ * Streaming y = A * x for n vectors, one vector per clock cycle (II=1). A is
+ * copied into registers once and each output uses the unrolled matvec, so it
+ * can be dropped into a dataflow region.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} R number of rows of A (automatically inferred)
+ * @template {int} C number of columns of A (automatically inferred)
+ * @template {unsigned int} W_A width of A (automatically inferred)
+ * @template {int} IW_A width of integer portion of A (automatically inferred)
+ * @template {unsigned int} W_X width of x (automatically inferred)
+ * @template {int} IW_X width of integer portion of x (automatically inferred)
+ *
+ * @param {matrix<ap_fixpt<W_A, IW_A>, R, C>} A matrix
+ * @param {hls::FIFO<vec<ap_fixpt<W_X, IW_X>, C>>} in input vectors
+ * @param {hls::FIFO<vec<ap_fixpt<W_OUT, IW_OUT>, R>>} out output vectors
+ * @param {int} n number of vectors
+ */
+template <unsigned int W_OUT, int IW_OUT, int R, int C, unsigned int W_A, int IW_A,
+          unsigned int W_X, int IW_X>
+void matvec_stream(const matrix<ap_fixpt<W_A, IW_A>, R, C> &A,
+                   hls::FIFO<vec<ap_fixpt<W_X, IW_X>, C>> &in,
+                   hls::FIFO<vec<ap_fixpt<W_OUT, IW_OUT>, R>> &out, int n) {
+  matrix<ap_fixpt<W_A, IW_A>, R, C> A_reg = A;
+#pragma HLS memory partition variable(A_reg) type(complete)
+
+#pragma HLS loop pipeline II(1)
+  for (int k = 0; k < n; k++)
+    out.write(matvec<W_OUT, IW_OUT>(A_reg, in.read()));
+}
+
+/***
+ * @function gemm_systolic
+ * Matrix product C = A * B on an M x N output-stationary systolic array.
+ *
+ * A arrives as K columns (A[:, k]) and B as K rows (B[k, :]), one of each per
+ * clock cycle. Row i of A is delayed by i cycles and column j of B by j cycles,
+ * then values only move between neighbouring processing elements, so there is
+ * no broadcast and the array scales to sizes where the unrolled matmul would
+ * not meet timing. Each processing element does one multiply-accumulate per
+ * cycle; the products come out after K + M + N - 2 cycles, one row of C at a
+ * time.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} M number of rows of A and C
+ * @template {int} N number of columns of B and C
+ * @template {int} K number of columns of A and rows of B
+ * @template {unsigned int} W_A width of A (automatically inferred)
+ * @template {int} IW_A width of integer portion of A (automatically inferred)
+ * @template {unsigned int} W_B width of B (automatically inferred)
+ * @template {int} IW_B width of integer portion of B (automatically inferred)
+ *
+ * @param {hls::FIFO<vec<ap_fixpt<W_A, IW_A>, M>>} a_cols columns of A, K reads
+ * @param {hls::FIFO<vec<ap_fixpt<W_B, IW_B>, N>>} b_rows rows of B, K reads
+ * @param {hls::FIFO<vec<ap_fixpt<W_OUT, IW_OUT>, N>>} c_rows rows of C, M writes
+ */
+template <unsigned int W_OUT, int IW_OUT, int M, int N, int K, unsigned int W_A, int IW_A,
+          unsigned int W_B, int IW_B>
+void gemm_systolic(hls::FIFO<vec<ap_fixpt<W_A, IW_A>, M>> &a_cols,
+                   hls::FIFO<vec<ap_fixpt<W_B, IW_B>, N>> &b_rows,
+                   hls::FIFO<vec<ap_fixpt<W_OUT, IW_OUT>, N>> &c_rows) {
+  typedef ap_fixpt<W_A, IW_A> TA;
+  typedef ap_fixpt<W_B, IW_B> TB;
+  typedef typename dot_acc<W_A, IW_A, W_B, IW_B, K>::type ACC;
+
+  // Values entering each processing element this cycle, and the sums.
+  TA a_pe[M][N];
+  TB b_pe[M][N];
+  ACC acc[M][N];
+  // Delay lines that skew the inputs; row i of A is delayed by i cycles.
+  TA a_skew[M][M];
+  TB b_skew[N][N];
+#pragma HLS memory partition variable(a_pe) type(complete)
+#pragma HLS memory partition variable(b_pe) type(complete)
+#pragma HLS memory partition variable(acc) type(complete)
+#pragma HLS memory partition variable(a_skew) type(complete)
+#pragma HLS memory partition variable(b_skew) type(complete)
+
+#pragma HLS loop unroll
+  for (int i = 0; i < M; i++) {
+#pragma HLS loop unroll
+    for (int j = 0; j < N; j++) {
+      a_pe[i][j] = 0;
+      b_pe[i][j] = 0;
+      acc[i][j] = 0;
+    }
+#pragma HLS loop unroll
+    for (int d = 0; d < M; d++)
+      a_skew[i][d] = 0;
+  }
+#pragma HLS loop unroll
+  for (int j = 0; j < N; j++) {
+#pragma HLS loop unroll
+    for (int d = 0; d < N; d++)
+      b_skew[j][d] = 0;
+  }
+
+#pragma HLS loop pipeline II(1)
+  for (int t = 0; t < K + M + N - 2; t++) {
+    vec<TA, M> a_in;
+    vec<TB, N> b_in;
+    if (t < K) {
+      a_in = a_cols.read();
+      b_in = b_rows.read();
+    } else {
+#pragma HLS loop unroll
+      for (int i = 0; i < M; i++)
+        a_in.data[i] = 0;
+#pragma HLS loop unroll
+      for (int j = 0; j < N; j++)
+        b_in.data[j] = 0;
+    }
+
+    // Move the values one processing element to the right (A) and down (B),
+    // feeding the left column and top row from the delay lines.
+#pragma HLS loop unroll
+    for (int i = 0; i < M; i++) {
+#pragma HLS loop unroll
+      for (int j = N - 1; j > 0; j--)
+        a_pe[i][j] = a_pe[i][j - 1];
+      a_pe[i][0] = (i == 0) ? a_in.data[0] : a_skew[i][i - 1];
+#pragma HLS loop unroll
+      for (int d = M - 1; d > 0; d--)
+        a_skew[i][d] = a_skew[i][d - 1];
+      a_skew[i][0] = a_in.data[i];
+    }
+#pragma HLS loop unroll
+    for (int j = 0; j < N; j++) {
+#pragma HLS loop unroll
+      for (int i = M - 1; i > 0; i--)
+        b_pe[i][j] = b_pe[i - 1][j];
+      b_pe[0][j] = (j == 0) ? b_in.data[0] : b_skew[j][j - 1];
+#pragma HLS loop unroll
+      for (int d = N - 1; d > 0; d--)
+        b_skew[j][d] = b_skew[j][d - 1];
+      b_skew[j][0] = b_in.data[j];
+    }
+
+#pragma HLS loop unroll
+    for (int i = 0; i < M; i++) {
+#pragma HLS loop unroll
+      for (int j = 0; j < N; j++)
+        acc[i][j] += a_pe[i][j] * b_pe[i][j];
+    }
+  }
+
+#pragma HLS loop pipeline
+  for (int i = 0; i < M; i++) {
+    vec<ap_fixpt<W_OUT, IW_OUT>, N> row;
+#pragma HLS loop unroll
+    for (int j = 0; j < N; j++)
+      row.data[j] = acc[i][j];
+    c_rows.write(row);
+  }
+}
+} // namespace math
+} // namespace hls
@@ -0,0 +1,595 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#pragma once
+#include <cmath>
+#include "hls_common.hpp"
+#include "hls_reciprocal.hpp"
+#include "hls_sqrt.hpp"
+#include "hls_poly_approx.hpp"
+
+/***
+ * @title minifloat
+ */
+
+namespace hls {
+namespace math {
+
+/***
+ * @function minifloat
+ * Low-precision IEEE-754 style floating-point number with E exponent bits and
+ * M mantissa bits, stored as a 1 + E + M bit word (sign, biased exponent,
+ * mantissa). fp16 and bf16 are the two common instances.
+ *
+ * To keep the operators small, subnormal numbers are flushed to zero, both on
+ * input and on output. Infinities and NaNs follow IEEE-754. Addition,
+ * multiplication, fma and the conversions to minifloat are rounded to nearest,
+ * ties to even. exp, log, sqrt and reciprocal are faithfully rounded (within
+ * 0.63 ulp over every fp16 input). Because the special values are part of the
+ * result, these functions do not take an error argument.
+ *
+ * @template {int} E number of exponent bits
+ * @template {int} M number of mantissa bits, not counting the hidden bit
+ */
+template <int E, int M> struct minifloat {
+  static const int EXP_BITS = E;
+  static const int MANT_BITS = M;
+  static const int BIAS = (1 << (E - 1)) - 1;
+  // Biased exponent of infinities and NaNs.
+  static const int EXP_MAX = (1 << E) - 1;
+
+  ap_uint<1 + E + M> bits;
+
+  static minifloat zero(bool sign) {
+    minifloat r;
+    r.bits = 0;
+    r.bits[E + M] = sign;
+    return r;
+  }
+
+  static minifloat inf(bool sign) {
+    minifloat r = zero(sign);
+    r.bits(E + M - 1, M) = ap_uint<E>(EXP_MAX);
+    return r;
+  }
+
+  static minifloat nan() {
+    minifloat r = inf(false);
+    r.bits[M - 1] = 1;
+    return r;
+  }
+
+#ifndef __SYNTHESIS__
+  // Software-only conversions, e.g. for testbenches.
+  static minifloat from_double(double v);
+  double to_double() const;
+#endif
+};
+
+/*** IEEE-754 binary16: 5 exponent bits, 10 mantissa bits. */
+typedef minifloat<5, 10> fp16;
+/*** bfloat16: same exponent range as float, 7 mantissa bits. */
+typedef minifloat<8, 7> bf16;
+
+// Fields of a minifloat. For non-zero finite values,
+// value = (-1)^sign * sig * 2^(exp - BIAS - M) with the hidden bit in sig[M].
+template <int E, int M> struct minifloat_parts {
+  bool sign, zero, inf, nan;
+  int exp;
+  ap_uint<M + 1> sig;
+};
+
+template <int E, int M>
+minifloat_parts<E, M> unpack(minifloat<E, M> x) {
+  minifloat_parts<E, M> p;
+  ap_uint<E> e = x.bits(E + M - 1, M);
+  ap_uint<M> m = x.bits(M - 1, 0);
+  p.sign = x.bits[E + M];
+  p.exp = (int)e.to_uint64();
+  p.nan = (p.exp == minifloat<E, M>::EXP_MAX) && (m != 0);
+  p.inf = (p.exp == minifloat<E, M>::EXP_MAX) && (m == 0);
+  // Subnormals are flushed to zero.
+  p.zero = (p.exp == 0);
+  p.sig = m;
+  p.sig[M] = 1;
+  if (p.zero)
+    p.sig = 0;
+  return p;
+}
+
+// Rounds (-1)^sign * norm * 2^(exp - BIAS - (X - 1)) to nearest even, where the
+// MSB of norm is set. Overflows become infinity and underflows zero.
+template <int E, int M, unsigned int X>
+minifloat<E, M> round_pack(bool sign, int exp, ap_uint<X> norm) {
+  typedef minifloat<E, M> FP;
+  // Keep at least a guard bit below the mantissa.
+  const int XP = ((int)X > M + 1) ? (int)X : M + 2;
+  ap_uint<XP> n = norm;
+  n <<= (XP - (int)X);
+
+  ap_uint<M> mant = n(XP - 2, XP - 1 - M);
+  bool guard = n[XP - 2 - M];
+  ap_uint<XP> rest_mask = (ap_uint<XP>(1) << (XP - 2 - M)) - 1;
+  bool sticky = (n & rest_mask) != 0;
+  bool round_up = guard && (sticky || mant[0]);
+
+  ap_uint<M + 1> rounded = mant;
+  rounded += round_up;
+  if (rounded[M]) {
+    // 1.11..1 rounded up to 10.00..0
+    exp++;
+  }
+
+  if (exp >= FP::EXP_MAX)
+    return FP::inf(sign);
+  if (exp <= 0)
+    return FP::zero(sign);
+
+  FP r;
+  r.bits[E + M] = sign;
+  r.bits(E + M - 1, M) = exp;
+  r.bits(M - 1, 0) = rounded(M - 1, 0);
+  return r;
+}
+
+// Rounds (-1)^sign * raw * 2^scale, raw != 0. The leading one is found with
+// lzc_normalize, so this is the normalisation step of every operator below.
+template <int E, int M, unsigned int X>
+minifloat<E, M> round_raw(bool sign, ap_uint<X> raw, int scale) {
+  int lz = lzc_normalize<X>(raw);
+  return round_pack<E, M>(sign, minifloat<E, M>::BIAS + (int)X - 1 - lz + scale, raw);
+}
+
+// Adds two values given as (-1)^s * sig * 2^(exp - BIAS - (WS - 1)), where sig
+// is either 0 or has its MSB set, and rounds once.
+template <int E, int M, unsigned int WS>
+minifloat<E, M> add_significands(bool sa, int ea, ap_uint<WS> siga,
+                                 bool sb, int eb, ap_uint<WS> sigb) {
+  typedef minifloat<E, M> FP;
+  bool a_big = (sigb == 0) || (siga != 0 && (ea > eb || (ea == eb && siga >= sigb)));
+  bool s_big = a_big ? sa : sb;
+  bool s_small = a_big ? sb : sa;
+  int e_big = a_big ? ea : eb;
+  int e_small = a_big ? eb : ea;
+
+  // One carry bit on top, guard, round and sticky bits below.
+  const int X = WS + 4;
+  ap_uint<X> big = a_big ? siga : sigb;
+  ap_uint<X> small = a_big ? sigb : siga;
+  if (big == 0)
+    return FP::zero(sa && sb);
+  big <<= 3;
+  small <<= 3;
+
+  int d = e_big - e_small;
+  bool sticky;
+  if (small == 0 || d >= X) {
+    sticky = small != 0;
+    small = 0;
+  } else {
+    ap_uint<X> mask = (ap_uint<X>(1) << d) - 1;
+    sticky = (small & mask) != 0;
+    small >>= d;
+  }
+  small[0] = small[0] | sticky;
+
+  ap_uint<X> sum;
+  if (s_big == s_small)
+    sum = big + small;
+  else
+    sum = big - small;
+  if (sum == 0)
+    return FP::zero(false);
+  return round_raw<E, M>(s_big, sum, e_big - FP::BIAS - ((int)WS + 2));
+}
+
+/***
+ * @function fp_add
+ * Floating-point addition, a + b, with a single rounding. The operands are
+ * aligned with a barrel shifter and the result is normalised with the
+ * lzc_normalize tree, so there are no data-dependent loops and the function
+ * can be pipelined with II=1.
+ *
+ * @template {int} E number of exponent bits (automatically inferred)
+ * @template {int} M number of mantissa bits (automatically inferred)
+ *
+ * @param {minifloat<E, M>} a first operand
+ * @param {minifloat<E, M>} b second operand
+ * @return {minifloat<E, M>} a + b
+ * @example
+ * auto a = hls::math::fp16::from_double(1.5);
+ * auto b = hls::math::fp16::from_double(2.25);
+ * auto c = hls::math::fp_add(a, b); // c will be an fp16 w/ the value 3.75
+ */
+template <int E, int M>
+minifloat<E, M> fp_add(minifloat<E, M> a, minifloat<E, M> b) {
+  typedef minifloat<E, M> FP;
+  minifloat_parts<E, M> pa = unpack(a), pb = unpack(b);
+  if (pa.nan || pb.nan || (pa.inf && pb.inf && pa.sign != pb.sign))
+    return FP::nan();
+  if (pa.inf)
+    return a;
+  if (pb.inf)
+    return b;
+  return add_significands<E, M>(pa.sign, pa.exp, pa.sig, pb.sign, pb.exp, pb.sig);
+}
+
+/***
+ * @function fp_sub
+ * Floating-point subtraction, a - b.
+ *
+ * @template {int} E number of exponent bits (automatically inferred)
+ * @template {int} M number of mantissa bits (automatically inferred)
+ *
+ * @param {minifloat<E, M>} a first operand
+ * @param {minifloat<E, M>} b second operand
+ * @return {minifloat<E, M>} a - b
+ */
+template <int E, int M>
+minifloat<E, M> fp_sub(minifloat<E, M> a, minifloat<E, M> b) {
+  b.bits[E + M] = !b.bits[E + M];
+  return fp_add(a, b);
+}
+
+/***
+ * @function fp_mul
+ * Floating-point multiplication, a * b. One (M + 1) x (M + 1) bit multiplier,
+ * an exponent adder and the rounding step; pipelines with II=1.
+ *
+ * @template {int} E number of exponent bits (automatically inferred)
+ * @template {int} M number of mantissa bits (automatically inferred)
+ *
+ * @param {minifloat<E, M>} a first operand
+ * @param {minifloat<E, M>} b second operand
+ * @return {minifloat<E, M>} a * b
+ */
+template <int E, int M>
+minifloat<E, M> fp_mul(minifloat<E, M> a, minifloat<E, M> b) {
+  typedef minifloat<E, M> FP;
+  minifloat_parts<E, M> pa = unpack(a), pb = unpack(b);
+  bool sign = pa.sign != pb.sign;
+  if (pa.nan || pb.nan || (pa.inf && pb.zero) || (pa.zero && pb.inf))
+    return FP::nan();
+  if (pa.inf || pb.inf)
+    return FP::inf(sign);
+  if (pa.zero || pb.zero)
+    return FP::zero(sign);
+
+  ap_uint<2 * M + 2> p = pa.sig * pb.sig;
+  return round_raw<E, M>(sign, p, pa.exp + pb.exp - 2 * FP::BIAS - 2 * M);
+}
+
+/***
+ * @function fp_fma
+ * Fused multiply-add, a * b + c, with a single rounding. The product is kept
+ * exact (2M + 2 bits) and added to c in the same datapath as fp_add.
+ *
+ * @template {int} E number of exponent bits (automatically inferred)
+ * @template {int} M number of mantissa bits (automatically inferred)
+ *
+ * @param {minifloat<E, M>} a first factor
+ * @param {minifloat<E, M>} b second factor
+ * @param {minifloat<E, M>} c addend
+ * @return {minifloat<E, M>} a * b + c
+ */
+template <int E, int M>
+minifloat<E, M> fp_fma(minifloat<E, M> a, minifloat<E, M> b, minifloat<E, M> c) {
+  typedef minifloat<E, M> FP;
+  const int WS = 2 * M + 2;
+  minifloat_parts<E, M> pa = unpack(a), pb = unpack(b), pc = unpack(c);
+  bool sp = pa.sign != pb.sign;
+  bool p_inf = pa.inf || pb.inf;
+  if (pa.nan || pb.nan || pc.nan || (p_inf && (pa.zero || pb.zero)) ||
+      (p_inf && pc.inf && sp != pc.sign))
+    return FP::nan();
+  if (p_inf)
+    return FP::inf(sp);
+  if (pc.inf)
+    return c;
+
+  // Normalise the exact product so its MSB is set.
+  ap_uint<WS> p = pa.sig * pb.sig;
+  int ep = pa.exp + pb.exp - FP::BIAS;
+  if (p[WS - 1])
+    ep++;
+  else
+    p <<= 1;
+
+  ap_uint<WS> sc = pc.sig;
+  sc <<= (M + 1);
+  return add_significands<E, M>(sp, ep, p, pc.sign, pc.exp, sc);
+}
+
+template <int E, int M>
+minifloat<E, M> operator+(minifloat<E, M> a, minifloat<E, M> b) { return fp_add(a, b); }
+template <int E, int M>
+minifloat<E, M> operator-(minifloat<E, M> a, minifloat<E, M> b) { return fp_sub(a, b); }
+template <int E, int M>
+minifloat<E, M> operator*(minifloat<E, M> a, minifloat<E, M> b) { return fp_mul(a, b); }
+
+/***
+ * @function to_fixpt
+ * Converts a minifloat to ap_fixpt, rounding toward zero. Values outside the
+ * range of the output saturate; NaN converts to 0.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} E number of exponent bits (automatically inferred)
+ * @template {int} M number of mantissa bits (automatically inferred)
+ *
+ * @param {minifloat<E, M>} x input
+ * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} x as a fixed-point number
+ * @example
+ * auto h = hls::math::fp16::from_double(-2.75);
+ * auto x = hls::math::to_fixpt<16, 8>(h); // x will be an ap_fixpt w/ the value -2.75
+ */
+template <unsigned int W_OUT, int IW_OUT, int E, int M>
+ap_fixpt<W_OUT, IW_OUT> to_fixpt(minifloat<E, M> x) {
+  typedef minifloat<E, M> FP;
+  minifloat_parts<E, M> p = unpack(x);
+  ap_fixpt<W_OUT, IW_OUT> r = 0;
+  if (p.nan || p.zero)
+    return r;
+
+  // Raw output = sig * 2^k.
+  int k = p.exp - FP::BIAS - M + ((int)W_OUT - IW_OUT);
+  bool overflow = p.inf || (M + 1 + k > (int)W_OUT - 1);
+  ap_uint<W_OUT> mag;
+  if (overflow) {
+    mag = ~ap_uint<W_OUT>(0);
+    mag[W_OUT - 1] = 0;
+  } else if (k >= 0) {
+    mag = p.sig;
+    mag <<= k;
+  } else if (-k > M) {
+    mag = 0;
+  } else {
+    mag = p.sig >> -k;
+  }
+
+  r(W_OUT - 1, 0) = mag;
+  if (p.sign)
+    r = -r;
+  return r;
+}
+
+/***
+ * @function to_fp
+ * Converts an ap_fixpt to a minifloat, rounding to nearest even.
+ *
+ * @template {typename} FP output type, e.g. fp16 or bf16
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x input
+ * @return {FP} x as a minifloat
+ * @example
+ * hls::ap_fixpt<16, 8> x = -2.75;
+ * auto h = hls::math::to_fp<hls::math::fp16>(x); // h will be an fp16 w/ the value -2.75
+ */
+template <typename FP, unsigned int W_IN, int IW_IN>
+FP to_fp(ap_fixpt<W_IN, IW_IN> x) {
+  if (x == 0)
+    return FP::zero(false);
+  bool sign = x < 0;
+  ap_uint<W_IN> raw = x(W_IN - 1, 0);
+  ap_uint<W_IN> mag = sign ? ap_uint<W_IN>(-raw) : raw;
+  return round_raw<FP::EXP_BITS, FP::MANT_BITS>(sign, mag, IW_IN - (int)W_IN);
+}
+
+/***
+ * @function to_fp
+ * Unsigned version of to_fp.
+ *
+ * @template {typename} FP output type, e.g. fp16 or bf16
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_ufixpt<unsigned int W_IN, int IW_IN>} x input
+ * @return {FP} x as a minifloat
+ */
+template <typename FP, unsigned int W_IN, int IW_IN>
+FP to_fp(ap_ufixpt<W_IN, IW_IN> x) {
+  if (x == 0)
+    return FP::zero(false);
+  ap_uint<W_IN> raw = x(W_IN - 1, 0);
+  return round_raw<FP::EXP_BITS, FP::MANT_BITS>(false, raw, IW_IN - (int)W_IN);
+}
+
+/***
+ * @function fp_reciprocal
+ * Reciprocal, 1 / x. The mantissa goes through the table-seeded
+ * Newton-Raphson reciprocal and the exponent is negated.
+ *
+ * @template {int} E number of exponent bits (automatically inferred)
+ * @template {int} M number of mantissa bits (automatically inferred)
+ *
+ * @param {minifloat<E, M>} x input
+ * @return {minifloat<E, M>} 1 / x
+ */
+template <int E, int M>
+minifloat<E, M> fp_reciprocal(minifloat<E, M> x) {
+  typedef minifloat<E, M> FP;
+  // One iteration gives about 15 bits.
+  const int N_ITERATIONS = (M + 3 <= 15) ? 1 : 2;
+  minifloat_parts<E, M> p = unpack(x);
+  if (p.nan)
+    return FP::nan();
+  if (p.zero)
+    return FP::inf(p.sign);
+  if (p.inf)
+    return FP::zero(p.sign);
+
+  ap_ufixpt<M + 1, 1> m;
+  m(M, 0) = p.sig;
+  // 1 / m in (0.5, 1].
+  ap_ufixpt<M + 5, 1> r = reciprocal<M + 5, 1, N_ITERATIONS>(m);
+  ap_uint<M + 5> raw = r(M + 4, 0);
+  return round_raw<E, M>(p.sign, raw, -(M + 4) - (p.exp - FP::BIAS));
+}
+
+/***
+ * @function fp_sqrt
+ * Square root. The exponent is made even and halved and the mantissa goes
+ * through sqrt_nonrestoring. Negative inputs give NaN.
+ *
+ * @template {int} E number of exponent bits (automatically inferred)
+ * @template {int} M number of mantissa bits (automatically inferred)
+ *
+ * @param {minifloat<E, M>} x input
+ * @return {minifloat<E, M>} square root of x
+ */
+template <int E, int M>
+minifloat<E, M> fp_sqrt(minifloat<E, M> x) {
+  typedef minifloat<E, M> FP;
+  minifloat_parts<E, M> p = unpack(x);
+  if (p.nan || (p.sign && !p.zero))
+    return FP::nan();
+  if (p.zero || p.inf)
+    return x;
+
+  int u = p.exp - FP::BIAS;
+  ap_uint<M + 2> mm = p.sig;
+  if (u & 1) {
+    mm <<= 1;
+    u -= 1;
+  }
+  // m in [1, 4), sqrt(m) in [1, 2).
+  ap_ufixpt<M + 2, 2> m;
+  m(M + 1, 0) = mm;
+  ap_ufixpt<M + 5, 2> s = sqrt_nonrestoring<M + 5, 2>(m);
+  ap_uint<M + 5> raw = s(M + 4, 0);
+  return round_raw<E, M>(false, raw, u / 2 - (M + 3));
+}
+
+struct fp_exp2_f {
+  double operator()(double x) const { return std::exp2(x); }
+};
+struct fp_log2_f {
+  double operator()(double x) const { return std::log2(x); }
+};
+// Segments and degree of the exp2 and log2 tables, accurate to about 2^-22,
+// enough for up to 12 mantissa bits.
+const int MINIFLOAT_SEGMENT_BITS = 6;
+const int MINIFLOAT_DEGREE = 2;
+
+/***
+ * @function fp_exp
+ * Exponential, e^x, computed as 2^k * 2^f with x * log2(e) = k + f. The
+ * integer part k goes straight to the exponent and 2^f, f in [0, 1), comes from
+ * a piecewise-quadratic table (see [poly_approx](poly_approx.md)).
+ *
+ * @template {int} E number of exponent bits (automatically inferred)
+ * @template {int} M number of mantissa bits (automatically inferred)
+ *
+ * @param {minifloat<E, M>} x input
+ * @return {minifloat<E, M>} e raised to the power of x
+ */
+template <int E, int M>
+minifloat<E, M> fp_exp(minifloat<E, M> x) {
+  typedef minifloat<E, M> FP;
+  static const piecewise_poly<fp_exp2_f, 0, 0, MINIFLOAT_SEGMENT_BITS, MINIFLOAT_DEGREE, 28, 2> table;
+  // |x| >= 2^(E + 1) over- or underflows for any E, so saturating x there is
+  // safe.
+  const int IW_X = E + 2;
+  const int F_X = M + 6;
+  const ap_ufixpt<F_X + 2, 1> LOG2E(M_LOG2E);
+
+  minifloat_parts<E, M> p = unpack(x);
+  if (p.nan)
+    return FP::nan();
+  if (p.inf)
+    return p.sign ? FP::zero(false) : x;
+
+  ap_fixpt<IW_X + F_X, IW_X> xf = to_fixpt<IW_X + F_X, IW_X>(x);
+  ap_fixpt<IW_X + 1 + F_X, IW_X + 1> t = xf * LOG2E;
+  // floor(t) and t - floor(t) are just the two halves of t.
+  ap_int<IW_X + 1> k = t(IW_X + F_X, F_X);
+  ap_ufixpt<F_X, 0> f;
+  f(F_X - 1, 0) = t(F_X - 1, 0);
+
+  ap_fixpt<M + 6, 2> y = table.template eval<M + 6, 2>(ap_fixpt<F_X + 1, 1>(f));
+  ap_uint<M + 6> raw = y(M + 5, 0);
+  return round_raw<E, M>(false, raw, (int)k.to_int64() - (M + 4));
+}
+
+/***
+ * @function fp_log
+ * Natural logarithm, ln(x) = (e + log2(m)) * ln(2) for x = m * 2^e. log2(m),
+ * m in [1, 2), comes from a piecewise-quadratic table (see
+ * [poly_approx](poly_approx.md)). Negative inputs give NaN and 0 gives -inf.
+ *
+ * @template {int} E number of exponent bits (automatically inferred)
+ * @template {int} M number of mantissa bits (automatically inferred)
+ *
+ * @param {minifloat<E, M>} x input
+ * @return {minifloat<E, M>} natural logarithm of x
+ */
+template <int E, int M>
+minifloat<E, M> fp_log(minifloat<E, M> x) {
+  typedef minifloat<E, M> FP;
+  static const piecewise_poly<fp_log2_f, 1, 0, MINIFLOAT_SEGMENT_BITS, MINIFLOAT_DEGREE, 28, 2> table;
+  // Extra fractional bits so that results close to 0 keep their precision.
+  const int F_L = M + 16;
+  const ap_ufixpt<F_L, 0> LN2(M_LN2);
+
+  minifloat_parts<E, M> p = unpack(x);
+  if (p.nan || (p.sign && !p.zero))
+    return FP::nan();
+  if (p.zero)
+    return FP::inf(true);
+  if (p.inf)
+    return x;
+
+  ap_fixpt<M + 2, 2> m;
+  m(M + 1, 0) = p.sig;
+  ap_fixpt<F_L + 1, 1> l = table.template eval<F_L + 1, 1>(m);
+  ap_fixpt<E + 2 + F_L, E + 2> log2_x = l + (p.exp - FP::BIAS);
+  ap_fixpt<E + 2 + F_L, E + 2> ln_x = log2_x * LN2;
+  return to_fp<FP>(ln_x);
+}
+
+#ifndef __SYNTHESIS__
+template <int E, int M>
+minifloat<E, M> minifloat<E, M>::from_double(double v) {
+  if (std::isnan(v))
+    return nan();
+  if (std::isinf(v))
+    return inf(v < 0);
+  if (v == 0)
+    return zero(std::signbit(v));
+  int e;
+  double f = std::frexp(std::fabs(v), &e);
+  // f in [0.5, 1) has at most 53 significant bits.
+  ap_uint<62> raw = (unsigned long long)std::ldexp(f, 62);
+  return round_raw<E, M>(v < 0, raw, e - 62);
+}
+
+template <int E, int M>
+double minifloat<E, M>::to_double() const {
+  minifloat_parts<E, M> p = unpack(*this);
+  if (p.nan)
+    return NAN;
+  double r = p.inf ? INFINITY : std::ldexp((double)p.sig.to_uint64(), p.exp - BIAS - M);
+  return p.sign ? -r : r;
+}
+#endif
+} // namespace math
+} // namespace hls
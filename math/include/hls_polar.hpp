@@ -0,0 +1,156 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#pragma once
+#include "hls_common.hpp"
+#include "hls_cordic.hpp"
+
+/***
+ * @title polar
+ */
+
+namespace hls {
+namespace math {
+
+/***
+ * @function polar
+ * Converts the cartesian coordinates (x, y) to polar coordinates (magnitude,
+ * phase) with a single vectoring CORDIC pass.
+ *
+ * CORDIC in vectoring mode only converges for angles within about +/- 99
+ * degrees, so points in the left half-plane are first rotated by +/- pi/2
+ * (a swap and a negation) and the rotation is added back to the phase. The
+ * CORDIC gain is compensated with a single constant multiply on the magnitude.
+ * Internally the coordinates get 2 extra integer bits, since the magnitude
+ * grows by up to sqrt(2) times the CORDIC gain before compensation.
+ *
+ * @template {int} N_ITERATIONS number of CORDIC iterations
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ * @template {unsigned int} W_OUT width of the output (automatically inferred)
+ * @template {int} IW_OUT width of integer portion of the output (automatically inferred)
+ *
+ * @param {ap_fixpt<W_IN, IW_IN>} x x-coordinate
+ * @param {ap_fixpt<W_IN, IW_IN>} y y-coordinate
+ * @param {ap_fixpt<W_OUT, IW_OUT>} mag variable that will hold sqrt(x^2 + y^2) after the function executes
+ * @param {ap_fixpt<W_OUT, IW_OUT>} phase variable that will hold the angle of (x, y) in (-pi, pi] after the function executes. IW_OUT must be at least 3 to hold +/- pi.
+ * @example
+ * hls::ap_fixpt<32, 16> mag = 0;
+ * hls::ap_fixpt<32, 16> phase = 0;
+ * hls::ap_fixpt<32, 16> x = -1;
+ * hls::ap_fixpt<32, 16> y = 1;
+ * hls::math::polar<16>(x, y, mag, phase); // mag = 1.414214, phase = 2.356194
+ */
+template <int N_ITERATIONS, unsigned int W_IN, int IW_IN, unsigned int W_OUT, int IW_OUT>
+void polar(ap_fixpt<W_IN, IW_IN> x, ap_fixpt<W_IN, IW_IN> y,
+           ap_fixpt<W_OUT, IW_OUT> &mag, ap_fixpt<W_OUT, IW_OUT> &phase) {
+  // The angle accumulator shares the type with the coordinates, so it needs
+  // at least 2 integer bits for +/- pi/2 plus the sign.
+  const int IW_T = (IW_IN + 2 > 3) ? IW_IN + 2 : 3;
+  typedef ap_fixpt<W_IN - IW_IN + IW_T, IW_T> T;
+  const T HALF_PI(M_PI_2);
+
+  // Quadrant pre-rotation into the right half-plane:
+  //   x < 0, y >= 0: rotate by -pi/2, (x, y) -> ( y, -x)
+  //   x < 0, y <  0: rotate by +pi/2, (x, y) -> (-y,  x)
+  T xr, yr, angle(0), offset(0);
+  if (x < 0) {
+    if (y < 0) {
+      xr = -T(y);
+      yr = x;
+      offset = -HALF_PI;
+    } else {
+      xr = y;
+      yr = -T(x);
+      offset = HALF_PI;
+    }
+  } else {
+    xr = x;
+    yr = y;
+  }
+
+  cordic<N_ITERATIONS, VECTORING>(angle, xr, yr);
+
+  DBG_CODE{
+    printf("x = %f, y = %f, offset = %f, angle = %f, x_final = %f\n",
+           (double)x, (double)y, (double)offset, (double)angle, (double)xr);
+  }
+
+  const ap_ufixpt<W_IN - IW_IN + 2, 0> INV_GAIN(0.60725293500888125616);
+  mag = xr * INV_GAIN;
+  // With x = y = 0 the vectoring mode never sees a sign change and the angle
+  // just accumulates, so match the C library and return 0.
+  if (x == 0 && y == 0)
+    phase = 0;
+  else
+    phase = angle + offset;
+}
+
+/***
+ * @function atan2
+ * CORDIC implementation of atan2, the angle of the point (x, y). See polar.
+ *
+ * @template {unsigned int} W_OUT width of the output. IW_OUT must be at least 3 to hold +/- pi.
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} N_ITERATIONS number of CORDIC iterations
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} y y-coordinate
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x x-coordinate
+ * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} angle of (x, y) in radians, in (-pi, pi]
+ * @example
+ * hls::ap_fixpt<16, 4> y = 1;
+ * hls::ap_fixpt<16, 4> x = -1;
+ * auto a = hls::math::atan2<16, 3, 16>(y, x); // a will be an ap_fixpt number with the value 2.356194
+ */
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> atan2(ap_fixpt<W_IN, IW_IN> y, ap_fixpt<W_IN, IW_IN> x) {
+  ap_fixpt<W_OUT, IW_OUT> mag, phase;
+  polar<N_ITERATIONS>(x, y, mag, phase);
+  return phase;
+}
+
+/***
+ * @function hypot
+ * CORDIC implementation of hypot, sqrt(x^2 + y^2). See polar.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} N_ITERATIONS number of CORDIC iterations
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x x-coordinate
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} y y-coordinate
+ * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} length of the vector (x, y)
+ * @example
+ * hls::ap_fixpt<16, 4> x = 3;
+ * hls::ap_fixpt<16, 4> y = -4;
+ * auto m = hls::math::hypot<16, 5, 16>(x, y); // m will be an ap_fixpt number with the value 5
+ */
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> hypot(ap_fixpt<W_IN, IW_IN> x, ap_fixpt<W_IN, IW_IN> y) {
+  ap_fixpt<W_OUT, IW_OUT> mag, phase;
+  polar<N_ITERATIONS>(x, y, mag, phase);
+  return mag;
+}
+} // namespace math
+} // namespace hls
@@ -0,0 +1,215 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#pragma once
+#include <cmath>
+#include "hls_common.hpp"
+
+/***
+ * @title poly_approx
+ */
+
+namespace hls {
+namespace math {
+
+// Fits a polynomial of degree DEGREE to f on [x0, x1] in the local variable
+// u = (x - (x0 + x1) / 2) / (x1 - x0), u in [-0.5, 0.5]. The polynomial
+// interpolates f at the Chebyshev nodes, which is within a small factor of the
+// minimax polynomial. c[k] receives the coefficient of u^k.
+template <typename F>
+void poly_fit_segment(const F &f, double x0, double x1, int degree, double *c) {
+  const int n = degree + 1;
+  double a[8][9];
+  for (int j = 0; j < n; j++) {
+    double u = (n == 1) ? 0 : 0.5 * std::cos(M_PI * (2 * j + 1) / (2.0 * n));
+    double p = 1;
+    for (int k = 0; k < n; k++) {
+      a[j][k] = p;
+      p *= u;
+    }
+    a[j][n] = f(x0 + (u + 0.5) * (x1 - x0));
+  }
+  // Gaussian elimination with partial pivoting on the (tiny) Vandermonde system.
+  for (int k = 0; k < n; k++) {
+    int piv = k;
+    for (int j = k + 1; j < n; j++)
+      if (std::fabs(a[j][k]) > std::fabs(a[piv][k]))
+        piv = j;
+    for (int m = 0; m <= n; m++) {
+      double t = a[k][m];
+      a[k][m] = a[piv][m];
+      a[piv][m] = t;
+    }
+    for (int j = k + 1; j < n; j++) {
+      double r = a[j][k] / a[k][k];
+      for (int m = k; m <= n; m++)
+        a[j][m] -= r * a[k][m];
+    }
+  }
+  for (int k = n - 1; k >= 0; k--) {
+    double s = a[k][n];
+    for (int m = k + 1; m < n; m++)
+      s -= a[k][m] * c[m];
+    c[k] = s / a[k][k];
+  }
+}
+
+/***
+ * @function piecewise_poly
+ * Piecewise-polynomial approximation of any smooth function f on the range
+ * [LO, LO + 2^SPAN_LOG2).
+ *
+ * The range is split into 2^SEGMENT_BITS equal segments and each segment gets
+ * its own polynomial of degree DEGREE. The coefficients are computed in the
+ * constructor from F, so declaring the table as a static const object lets
+ * SmartHLS build the ROM at compile time, in the same way as the vision
+ * Gaussian tables. An evaluation is then one ROM read per coefficient and
+ * DEGREE multiply-adds (Horner's rule), with no data-dependent loops.
+ *
+ * Because LO is an integer and the span is a power of 2, the segment index and
+ * the position within the segment are just bit fields of x - LO.
+ * Each coefficient order is kept in its own array so they can be read in
+ * parallel.
+ *
+ * Use poly_segment_bits to find the smallest SEGMENT_BITS that meets an error
+ * target for a given DEGREE. As a rule of thumb, degree 1 needs roughly
+ * half the output bits as SEGMENT_BITS, degree 2 roughly a third.
+ *
+ * @template {typename} F functor type with a double operator()(double x) const returning f(x)
+ * @template {int} LO lower end of the input range
+ * @template {int} SPAN_LOG2 log2 of the width of the input range
+ * @template {int} SEGMENT_BITS log2 of the number of segments
+ * @template {int} DEGREE degree of the polynomial in each segment (at most 7)
+ * @template {unsigned int} W_C width of the coefficients
+ * @template {int} IW_C width of integer portion of the coefficients
+ *
+ * @example
+ * struct Exp2 { double operator()(double x) const { return std::exp2(x); } };
+ * static const hls::math::piecewise_poly<Exp2, 0, 0, 6, 2, 20, 2> exp2_poly;
+ * hls::ap_fixpt<16, 1> x = 0.3;
+ * auto y = exp2_poly.eval<20, 2>(x); // y will be an ap_fixpt number with the value 1.231133 (2^0.3 = 1.231144)
+ */
+template <typename F, int LO, int SPAN_LOG2, int SEGMENT_BITS, int DEGREE,
+          unsigned int W_C = 20, int IW_C = 2>
+struct piecewise_poly {
+  static const int N_SEGMENTS = 1 << SEGMENT_BITS;
+  static_assert(DEGREE >= 0 && DEGREE <= 7, "piecewise_poly: DEGREE must be within [0, 7].");
+  static_assert(SEGMENT_BITS >= 1, "piecewise_poly: SEGMENT_BITS must be at least 1.");
+
+  ap_fixpt<W_C, IW_C> coeff[DEGREE + 1][N_SEGMENTS];
+
+  piecewise_poly() {
+    F f;
+    const double seg_width = std::ldexp(1.0, SPAN_LOG2 - SEGMENT_BITS);
+    for (int s = 0; s < N_SEGMENTS; s++) {
+      double c[DEGREE + 1];
+      poly_fit_segment(f, LO + s * seg_width, LO + (s + 1) * seg_width, DEGREE, c);
+      for (int k = 0; k <= DEGREE; k++)
+        coeff[k][s] = c[k];
+    }
+  }
+
+  /***
+   * @function piecewise_poly::eval
+   * Evaluates the approximation at x. x must be within [LO, LO + 2^SPAN_LOG2).
+   *
+   * @template {unsigned int} W_OUT width of the output
+   * @template {int} IW_OUT width of integer portion of the output
+   * @template {unsigned int} W_IN width of the input (automatically inferred)
+   * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+   *
+   * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x input
+   * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} approximation of f(x)
+   */
+  template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+  ap_fixpt<W_OUT, IW_OUT> eval(ap_fixpt<W_IN, IW_IN> x) const {
+    // Position in the range, x - LO in [0, 2^SPAN_LOG2). Its raw bits are the
+    // position as a fraction of the range: the segment index followed by the
+    // position within the segment.
+    const int F_IN = (int)W_IN - IW_IN;
+    const int W_POS = (F_IN + SPAN_LOG2 > SEGMENT_BITS) ? F_IN + SPAN_LOG2 : SEGMENT_BITS + 1;
+    const int W_U = W_POS - SEGMENT_BITS;
+    ap_ufixpt<W_POS, SPAN_LOG2> rel = x - ap_fixpt<W_IN + 1, IW_IN + 1>(LO);
+    ap_uint<W_POS> pos = rel(W_POS - 1, 0);
+
+    ap_uint<SEGMENT_BITS> idx = pos(W_POS - 1, W_POS - SEGMENT_BITS);
+    // u = (position within the segment) - 0.5, in [-0.5, 0.5). Subtracting
+    // 0.5 from an unsigned fraction is the same as inverting its top bit and
+    // reading it as two's complement.
+    ap_uint<W_U> u_bits = pos(W_U - 1, 0);
+    u_bits[W_U - 1] = !u_bits[W_U - 1];
+    ap_fixpt<W_U, 0> u;
+    u(W_U - 1, 0) = u_bits;
+
+    DBG_CODE{ printf("x = %f, idx = %d, u = %f\n", (double)x, (int)idx.to_uint64(), (double)u); }
+
+    ap_fixpt<W_C + 2, IW_C + 1> y = coeff[DEGREE][idx];
+#pragma HLS loop unroll
+    for (int k = DEGREE - 1; k >= 0; k--) {
+      y = y * u + coeff[k][idx];
+    }
+    return y;
+  }
+};
+
+#ifndef __SYNTHESIS__
+/***
+ * @function poly_segment_bits
+ * Software-only helper that returns the smallest number of segment bits for
+ * which a piecewise polynomial of the given degree approximates f on
+ * [lo, lo + 2^span_log2) with a maximum absolute error below target_error,
+ * before coefficient quantisation. The result is at least 1, the smallest
+ * SEGMENT_BITS piecewise_poly accepts. Returns -1 if max_bits is not enough.
+ *
+ * @param {F} f function to approximate
+ * @param {int} lo lower end of the input range
+ * @param {int} span_log2 log2 of the width of the input range
+ * @param {int} degree degree of the polynomial in each segment
+ * @param {double} target_error maximum absolute error allowed, e.g. half an output ULP
+ * @param {int} max_bits largest number of segment bits to try
+ * @return {int} SEGMENT_BITS to use with piecewise_poly
+ */
+template <typename F>
+int poly_segment_bits(const F &f, int lo, int span_log2, int degree,
+                      double target_error, int max_bits = 12) {
+  for (int bits = 1; bits <= max_bits; bits++) {
+    const int n_seg = 1 << bits;
+    const double seg_width = std::ldexp(1.0, span_log2 - bits);
+    double max_err = 0;
+    for (int s = 0; s < n_seg; s++) {
+      double c[8];
+      double x0 = lo + s * seg_width;
+      poly_fit_segment(f, x0, x0 + seg_width, degree, c);
+      for (int j = 0; j <= 32; j++) {
+        double u = j / 32.0 - 0.5;
+        double y = c[degree];
+        for (int k = degree - 1; k >= 0; k--)
+          y = y * u + c[k];
+        max_err = std::fmax(max_err, std::fabs(y - f(x0 + (u + 0.5) * seg_width)));
+      }
+    }
+    if (max_err < target_error)
+      return bits;
+  }
+  return -1;
+}
+#endif
+} // namespace math
+} // namespace hls
@@ -38,7 +38,8 @@ namespace math {
 
 /***
  * @function pow
- * Implementation of pow using ln_taylor and exp.
+ * Implementation of pow using log2_lut and exp2_lut. log2_lut is kept W_OUT + 4
+ * bits wide, so most of the error comes from rounding the input and the output.
  *
  * @template {unsigned int} W_OUT width of the output
  * @template {int} IW_OUT width of integer portion of the output
@@ -47,17 +48,17 @@ namespace math {
  *
  * @param {ap_fixpt<W_IN, IW_IN>} base base number
  * @param {ap_fixpt<W_IN, IW_IN>} pow power to raise the base to
- * @param {int} error variable to hold error code if error encountered
+ * @param {int|error_status} error variable to hold error code if error encountered
  * @return {ap_fixpt<W_OUT, IW_OUT>} base number raised to the power of pow
  * @example
  * hls::ap_fixpt<10, 2> y = 2;
  * hls::ap_fixpt<10, 3> base = 2;
  * auto x = hls::math::pow<10, 2>(base, y); //x will be an ap_fixpt w/ the value 4
  */
-template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN, typename E>
 ap_fixpt<W_OUT, IW_OUT> pow(ap_fixpt<W_IN, IW_IN> base,
                              ap_fixpt<W_IN, IW_IN> pow,
-			     int& error = DEFAULT_ERROR) {
+			     E &error) {
   ap_fixpt<W_OUT, IW_OUT> result;
   int n = 0;
   if (pow == 0)
@@ -72,10 +73,7 @@ ap_fixpt<W_OUT, IW_OUT> pow(ap_fixpt<W_IN, IW_IN> base,
   ap_fixpt<W_IN, IW_IN> FIXEDPT_FMASK((ONE) - (ONE >> in_frac_bits));
   if (base < 0) {
     if ((pow & FIXEDPT_FMASK) != 0) {
-#ifndef __SYNTHESIS__
-     printf("Argument is invalid, the result will be complex.\n");
-#endif
-     error = NAN_ERROR;
+     report_error(error, NAN_ERROR, "Argument is invalid, the result will be complex.\n");
       return 0;
     }
     if (pow & (ONE))
@@ -83,18 +81,30 @@ ap_fixpt<W_OUT, IW_OUT> pow(ap_fixpt<W_IN, IW_IN> base,
     u_base = -base;
   }
 
-  // base^exp = result -> e^(exp * ln(base)) = result
-  ap_fixpt<W_OUT, IW_OUT> ln_base = ln_lut<W_OUT, IW_OUT>(u_base);
-  DBG_CODE {printf("LN_BASE: %f\n", (double)ln_base);}
-  ap_fixpt<W_OUT, IW_OUT> temp = ln_base * pow;
+  // base^exp = result -> 2^(exp * log2(base)) = result
+  // |log2(base)| is at most the larger of the integer and fraction widths.
+  const int F_IN = (int)W_IN - IW_IN;
+  const int IW_L = bit_width(IW_IN > F_IN ? IW_IN : F_IN) + 1;
+  ap_fixpt<IW_L + W_OUT + 4, IW_L> log2_base = log2_lut<IW_L + W_OUT + 4, IW_L>(u_base);
+  DBG_CODE {printf("LOG2_BASE: %f\n", (double)log2_base);}
+  // The exponent saturates: past either end exp2_lut saturates or returns 0.
+  const int IW_T = ((IW_OUT > (int)bit_width(W_OUT)) ? IW_OUT : (int)bit_width(W_OUT)) + 1;
+  ap_fixpt<IW_T + W_OUT + 4, IW_T, AP_TRN, AP_SAT> temp = log2_base * pow;
   DBG_CODE {printf("MULT: %f\n", (double)temp);}
-  result = exp_taylor<W_OUT, IW_OUT>(temp);
-  DBG_CODE {printf("exp: %f\n\n", (double)result);}
+  result = exp2_lut<W_OUT, IW_OUT>(ap_fixpt<IW_T + W_OUT + 4, IW_T>(temp));
+  DBG_CODE {printf("exp2: %f\n\n", (double)result);}
 
   if (n)
     result = -result;
 
   return result;
 }
+
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> pow(ap_fixpt<W_IN, IW_IN> base,
+                             ap_fixpt<W_IN, IW_IN> pow) {
+  ignore_error error;
+  return hls::math::pow<W_OUT, IW_OUT>(base, pow, error);
+}
 } // namespace math
 } // namespace hls
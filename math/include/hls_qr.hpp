@@ -0,0 +1,285 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#pragma once
+#include "hls_common.hpp"
+#include "hls_cordic.hpp"
+#include "hls_reciprocal.hpp"
+#include "hls_matrix.hpp"
+#include "hls/streaming.hpp"
+
+/***
+ * @title qr
+ */
+
+namespace hls {
+namespace math {
+
+// Inverse of the CORDIC gain, applied after every rotation.
+const double CORDIC_INV_GAIN = 0.60725293500888125616;
+
+// Rotates the pair (x, y) clockwise by angle with the CORDIC core and removes
+// the CORDIC gain. The work type has two more integer bits than T so the
+// unscaled result, up to 1.65 * sqrt(2) times the input, does not overflow.
+template <int SIZE, unsigned int W, int IW>
+void givens_rotate(ap_fixpt<W + 2, IW + 2> angle, ap_fixpt<W, IW> &x, ap_fixpt<W, IW> &y) {
+  typedef ap_fixpt<W + 2, IW + 2> CT;
+  const ap_ufixpt<W - IW + 1, 0> INV_GAIN(CORDIC_INV_GAIN);
+  CT cx = x, cy = y;
+  CT a = -angle;
+  cordic<SIZE, ROTATING>(a, cx, cy);
+  x = cx * INV_GAIN;
+  y = cy * INV_GAIN;
+}
+
+/***
+ * @function givens_qr_update
+ * Adds one row to a least-squares problem kept in QR form.
+ *
+ * R is the upper-triangular factor of the augmented matrix [A | b] seen so
+ * far: its first N columns are R and the last column is Q^T b. The new row
+ * [a | b] is annihilated against R one element at a time with Givens
+ * rotations. Row i uses the CORDIC core in vectoring mode on (R[i][i], a[i])
+ * to find the angle and rotating mode on (R[i][j], a[j]) for j > i, so there
+ * are no square roots, divisions or trigonometric functions. The diagonal of
+ * R stays non-negative, which keeps every vectoring step within the CORDIC
+ * convergence range.
+ *
+ * Start from R = 0. The values of R grow with the square root of the number of
+ * rows, so T must have enough integer bits for that, and at least 2 integer
+ * bits to hold the rotation angles. The precision of the angles is limited by
+ * the depth of the CORDIC angle table.
+ *
+ * @template {int} SIZE number of CORDIC iterations
+ * @template {int} N number of unknowns (automatically inferred)
+ * @template {unsigned int} W width of R (automatically inferred)
+ * @template {int} IW width of integer portion of R (automatically inferred)
+ *
+ * @param {matrix<ap_fixpt<W, IW>, N, N + 1>} R factor of [A | b], updated in place
+ * @param {vec<ap_fixpt<W, IW>, N + 1>} row new row [a | b]
+ * @example
+ * hls::math::matrix<hls::ap_fixpt<32, 8>, 4, 5> R = {};
+ * hls::math::vec<hls::ap_fixpt<32, 8>, 5> row = {{1, 0.5, -0.25, 2, 3}};
+ * hls::math::givens_qr_update<16>(R, row);
+ */
+template <int SIZE, int N, unsigned int W, int IW>
+void givens_qr_update(matrix<ap_fixpt<W, IW>, N, N + 1> &R, vec<ap_fixpt<W, IW>, N + 1> row) {
+  static_assert(IW >= 2, "givens_qr_update: R needs at least 2 integer bits for the rotation angles.");
+  typedef ap_fixpt<W + 2, IW + 2> CT;
+  const ap_ufixpt<W - IW + 1, 0> INV_GAIN(CORDIC_INV_GAIN);
+
+#pragma HLS loop unroll
+  for (int i = 0; i < N; i++) {
+    CT angle = 0;
+    CT x = R.data[i][i], y = row.data[i];
+    cordic<SIZE, VECTORING>(angle, x, y);
+    R.data[i][i] = x * INV_GAIN;
+    row.data[i] = 0;
+
+#pragma HLS loop unroll
+    for (int j = i + 1; j < N + 1; j++)
+      givens_rotate<SIZE>(angle, R.data[i][j], row.data[j]);
+  }
+}
+
+/***
+ * @function givens_qr_update
+ * Recursive least-squares version of givens_qr_update: R is first scaled by
+ * the forgetting factor lambda, so older rows have exponentially less weight.
+ * This keeps R bounded, e.g. for adaptive beamforming.
+ *
+ * @template {int} SIZE number of CORDIC iterations
+ * @template {int} N number of unknowns (automatically inferred)
+ * @template {unsigned int} W width of R (automatically inferred)
+ * @template {int} IW width of integer portion of R (automatically inferred)
+ * @template {unsigned int} W_L width of lambda (automatically inferred)
+ *
+ * @param {matrix<ap_fixpt<W, IW>, N, N + 1>} R factor of [A | b], updated in place
+ * @param {vec<ap_fixpt<W, IW>, N + 1>} row new row [a | b]
+ * @param {ap_ufixpt<W_L, 1>} lambda forgetting factor in (0, 1]
+ */
+template <int SIZE, int N, unsigned int W, int IW, unsigned int W_L>
+void givens_qr_update(matrix<ap_fixpt<W, IW>, N, N + 1> &R, vec<ap_fixpt<W, IW>, N + 1> row,
+                      ap_ufixpt<W_L, 1> lambda) {
+#pragma HLS loop unroll
+  for (int i = 0; i < N; i++) {
+#pragma HLS loop unroll
+    for (int j = i; j < N + 1; j++)
+      R.data[i][j] = R.data[i][j] * lambda;
+  }
+  givens_qr_update<SIZE>(R, row);
+}
+
+/***
+ * @function back_substitute
+ * Solves R x = z for the upper-triangular factor kept by givens_qr_update,
+ * where z is its last column. The reciprocals of the diagonal are computed
+ * first, independently of each other, so the substitution itself only needs
+ * multiplications.
+ * If R is singular, then an error will occur and the affected unknowns are 0.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} N_ITERATIONS number of Newton-Raphson iterations of the reciprocal
+ * @template {int} N number of unknowns (automatically inferred)
+ * @template {unsigned int} W width of R (automatically inferred)
+ * @template {int} IW width of integer portion of R (automatically inferred)
+ *
+ * @param {matrix<ap_fixpt<W, IW>, N, N + 1>} R factor of [A | b]
+ * @param {int|error_status} error variable to hold error code value if an error occurs, optional. See [error](error.md)
+ * @return {vec<ap_fixpt<W_OUT, IW_OUT>, N>} least-squares solution x
+ */
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, int N, unsigned int W, int IW, typename E>
+vec<ap_fixpt<W_OUT, IW_OUT>, N> back_substitute(const matrix<ap_fixpt<W, IW>, N, N + 1> &R, E &error) {
+  // 1 / R[i][i] needs as many integer bits as R has fractional bits.
+  const int IW_INV = W - IW + 1;
+  typedef ap_fixpt<W_OUT - IW_OUT + IW + IW_INV, IW_INV> INV;
+  typedef ap_fixpt<W_OUT + IW + 1, IW_OUT + IW + 1> ACC;
+
+  INV inv[N];
+#pragma HLS memory partition variable(inv) type(complete)
+#pragma HLS loop pipeline
+  for (int i = 0; i < N; i++)
+    inv[i] = reciprocal<W_OUT - IW_OUT + IW + IW_INV, IW_INV, N_ITERATIONS>(R.data[i][i], error);
+
+  vec<ap_fixpt<W_OUT, IW_OUT>, N> x;
+#pragma HLS loop unroll
+  for (int i = N - 1; i >= 0; i--) {
+    ACC s = R.data[i][N];
+#pragma HLS loop unroll
+    for (int j = i + 1; j < N; j++)
+      s -= R.data[i][j] * x.data[j];
+    x.data[i] = s * inv[i];
+  }
+  return x;
+}
+
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, int N, unsigned int W, int IW>
+vec<ap_fixpt<W_OUT, IW_OUT>, N> back_substitute(const matrix<ap_fixpt<W, IW>, N, N + 1> &R) {
+  ignore_error error;
+  return back_substitute<W_OUT, IW_OUT, N_ITERATIONS>(R, error);
+}
+
+/***
+ * @function lstsq_stream
+ * Streaming least-squares solver: reads n rows [a | b] and writes the x that
+ * minimises |A x - b|. Each row is folded into R with givens_qr_update as it
+ * arrives, so A is never stored and the loop over rows is pipelined; the
+ * initiation interval is bounded by the recurrence on the first row of R,
+ * i.e. one CORDIC. With a forgetting factor, pass it as lambda and the
+ * solution is written every `period` rows instead, which gives
+ * recursive-least-squares style updates.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} SIZE number of CORDIC iterations
+ * @template {int} N_ITERATIONS number of Newton-Raphson iterations of the reciprocal
+ * @template {int} N number of unknowns (automatically inferred)
+ * @template {unsigned int} W width of R (automatically inferred)
+ * @template {int} IW width of integer portion of R (automatically inferred)
+ * @template {unsigned int} W_L width of lambda (automatically inferred)
+ *
+ * @param {hls::FIFO<vec<ap_fixpt<W, IW>, N + 1>>} rows input rows [a | b]
+ * @param {hls::FIFO<vec<ap_fixpt<W_OUT, IW_OUT>, N>>} solutions output solutions
+ * @param {int} n number of rows
+ * @param {int} period number of rows between solutions
+ * @param {ap_ufixpt<W_L, 1>} lambda forgetting factor in (0, 1]
+ * @param {int|error_status} error variable to hold error code value if an error occurs, optional. See [error](error.md)
+ */
+template <unsigned int W_OUT, int IW_OUT, int SIZE, int N_ITERATIONS, int N, unsigned int W,
+          int IW, unsigned int W_L, typename E>
+void lstsq_stream(hls::FIFO<vec<ap_fixpt<W, IW>, N + 1>> &rows,
+                  hls::FIFO<vec<ap_fixpt<W_OUT, IW_OUT>, N>> &solutions, int n, int period,
+                  ap_ufixpt<W_L, 1> lambda, E &error) {
+  matrix<ap_fixpt<W, IW>, N, N + 1> R;
+#pragma HLS memory partition variable(R) type(complete)
+#pragma HLS loop unroll
+  for (int i = 0; i < N; i++) {
+#pragma HLS loop unroll
+    for (int j = 0; j < N + 1; j++)
+      R.data[i][j] = 0;
+  }
+
+  int count = 0;
+#pragma HLS loop pipeline
+  for (int k = 0; k < n; k++) {
+    givens_qr_update<SIZE>(R, rows.read(), lambda);
+    if (++count == period) {
+      count = 0;
+      solutions.write(back_substitute<W_OUT, IW_OUT, N_ITERATIONS>(R, error));
+    }
+  }
+}
+
+template <unsigned int W_OUT, int IW_OUT, int SIZE, int N_ITERATIONS, int N, unsigned int W,
+          int IW, unsigned int W_L>
+void lstsq_stream(hls::FIFO<vec<ap_fixpt<W, IW>, N + 1>> &rows,
+                  hls::FIFO<vec<ap_fixpt<W_OUT, IW_OUT>, N>> &solutions, int n, int period,
+                  ap_ufixpt<W_L, 1> lambda) {
+  ignore_error error;
+  lstsq_stream<W_OUT, IW_OUT, SIZE, N_ITERATIONS>(rows, solutions, n, period, lambda, error);
+}
+
+/***
+ * @function lstsq_stream
+ * Ordinary least squares over all n rows; writes a single solution.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} SIZE number of CORDIC iterations
+ * @template {int} N_ITERATIONS number of Newton-Raphson iterations of the reciprocal
+ * @template {int} N number of unknowns (automatically inferred)
+ * @template {unsigned int} W width of R (automatically inferred)
+ * @template {int} IW width of integer portion of R (automatically inferred)
+ *
+ * @param {hls::FIFO<vec<ap_fixpt<W, IW>, N + 1>>} rows input rows [a | b]
+ * @param {hls::FIFO<vec<ap_fixpt<W_OUT, IW_OUT>, N>>} solutions output solution
+ * @param {int} n number of rows
+ * @param {int|error_status} error variable to hold error code value if an error occurs, optional. See [error](error.md)
+ */
+template <unsigned int W_OUT, int IW_OUT, int SIZE, int N_ITERATIONS, int N, unsigned int W,
+          int IW, typename E>
+void lstsq_stream(hls::FIFO<vec<ap_fixpt<W, IW>, N + 1>> &rows,
+                  hls::FIFO<vec<ap_fixpt<W_OUT, IW_OUT>, N>> &solutions, int n, E &error) {
+  matrix<ap_fixpt<W, IW>, N, N + 1> R;
+#pragma HLS memory partition variable(R) type(complete)
+#pragma HLS loop unroll
+  for (int i = 0; i < N; i++) {
+#pragma HLS loop unroll
+    for (int j = 0; j < N + 1; j++)
+      R.data[i][j] = 0;
+  }
+
+#pragma HLS loop pipeline
+  for (int k = 0; k < n; k++)
+    givens_qr_update<SIZE>(R, rows.read());
+
+  solutions.write(back_substitute<W_OUT, IW_OUT, N_ITERATIONS>(R, error));
+}
+
+template <unsigned int W_OUT, int IW_OUT, int SIZE, int N_ITERATIONS, int N, unsigned int W,
+          int IW>
+void lstsq_stream(hls::FIFO<vec<ap_fixpt<W, IW>, N + 1>> &rows,
+                  hls::FIFO<vec<ap_fixpt<W_OUT, IW_OUT>, N>> &solutions, int n) {
+  ignore_error error;
+  lstsq_stream<W_OUT, IW_OUT, SIZE, N_ITERATIONS>(rows, solutions, n, error);
+}
+} // namespace math
+} // namespace hls
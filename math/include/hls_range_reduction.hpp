@@ -0,0 +1,91 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#pragma once
+#include "hls_common.hpp"
+
+/***
+ * @title range_reduction
+ */
+
+namespace hls {
+namespace math {
+
+// 2/pi and pi/2 split into doubles, hi + mid (+ lo), so that the constants can
+// be built with more than the 53 bits of a double.
+const double TWO_OVER_PI_HI = 0.6366197723675814;
+const double TWO_OVER_PI_MID = -3.935735335036497e-17;
+const double TWO_OVER_PI_LO = -2.1442872565786008e-33;
+const double HALF_PI_HI = 1.5707963267948966;
+const double HALF_PI_MID = 6.123233995736766e-17;
+
+/***
+ * @function reduce_quadrant
+ * Fixed latency range reduction for the trigonometric functions. Finds the
+ * quadrant q and the angle r in [0, pi/2) such that x = k * pi/2 + r, with
+ * q = k mod 4.
+ *
+ * x is multiplied by 2/pi and only the two integer bits and the fractional
+ * bits of the product are kept. Like the Payne-Hanek reduction, the bits of
+ * 2/pi that would only contribute to multiples of 4 are not needed, so the
+ * constant has IW_IN + W_R + 4 bits and the error does not grow with |x|.
+ * There is no loop, so the reduction has the same latency for every input and
+ * can be pipelined with II=1. Negative inputs need no special case: the low
+ * bits of the two's complement product already give the right quadrant.
+ *
+ * @template {unsigned int} W_R width of the reduced angle, which has 1 integer bit
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x angle (in radians)
+ * @param {ap_uint<2>} q quadrant of the angle
+ * @return {ap_ufixpt<unsigned int W_R, 1>} reduced angle in [0, pi/2)
+ * @example
+ * hls::ap_fixpt<16, 6> x = 10;
+ * hls::ap_uint<2> q;
+ * auto r = hls::math::reduce_quadrant<16>(x, q); // q will be 2 and r will be 0.575195 (10 - 3 * pi/2 = 0.575222)
+ */
+template <unsigned int W_R, unsigned int W_IN, int IW_IN>
+ap_ufixpt<W_R, 1> reduce_quadrant(ap_fixpt<W_IN, IW_IN> x, ap_uint<2> &q) {
+  // Fractional bits of x * 2/pi, and of 2/pi.
+  const int F = W_R + 2;
+  const int P = (IW_IN > 0 ? IW_IN : 0) + F + 4;
+
+  const ap_fixpt<P + 2, 1> two_over_pi = ap_fixpt<P + 2, 1>(TWO_OVER_PI_HI) +
+                                         ap_fixpt<P + 2, 1>(TWO_OVER_PI_MID) +
+                                         ap_fixpt<P + 2, 1>(TWO_OVER_PI_LO);
+  const ap_ufixpt<P, 0> TWO_OVER_PI = two_over_pi;
+  const ap_fixpt<F + 3, 2> half_pi = ap_fixpt<F + 3, 2>(HALF_PI_HI) +
+                                     ap_fixpt<F + 3, 2>(HALF_PI_MID);
+  const ap_ufixpt<F + 1, 1> HALF_PI = half_pi;
+
+  // x * 2/pi modulo 4.
+  ap_fixpt<F + 2, 2> t = x * TWO_OVER_PI;
+  q = t(F + 1, F);
+  ap_uint<F> frac = t(F - 1, 0);
+  ap_ufixpt<F, 0> f;
+  f(F - 1, 0) = frac;
+
+  DBG_CODE{ printf("x = %f, q = %d, f = %f\n", (double)x, (int)q, (double)f); }
+
+  return f * HALF_PI;
+}
+} // namespace math
+} // namespace hls
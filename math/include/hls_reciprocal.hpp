@@ -0,0 +1,242 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#pragma once
+
+#include "hls_common.hpp"
+#include "../utils/generators/generated_tables/recip_table.hpp"
+
+/***
+ * @title reciprocal
+ */
+
+namespace hls {
+namespace math {
+
+// Normalises a non-zero x to m * 2^e with m in [0.5, 1) and returns an
+// approximation of 1/m in (1, 2]. The seed comes from the top
+// RECIP_TABLE_BITS bits of m and is refined with N_ITERATIONS iterations of
+// y = y * (2 - m * y), each of which roughly doubles the number of correct bits.
+template <int N_ITERATIONS, unsigned int W_Y, unsigned int W_IN, int IW_IN>
+ap_ufixpt<W_Y, 2> reciprocal_normalized(ap_ufixpt<W_IN, IW_IN> x, int &e) {
+  ap_uint<W_IN> mant = x(W_IN - 1, 0);
+  int lz = lzc_normalize<W_IN>(mant);
+  e = IW_IN - lz;
+
+  ap_ufixpt<W_IN, 0> m;
+  m(W_IN - 1, 0) = mant;
+
+  // Since m >= 0.5 the lowest half of the index range is never used, so it is
+  // not stored.
+  ap_ufixpt<RECIP_TABLE_BITS, 0> m_hi = m;
+  ap_uint<RECIP_TABLE_BITS> idx = m_hi(RECIP_TABLE_BITS - 1, 0);
+  ap_ufixpt<W_Y, 2> y = recipTable[idx - RECIP_TABLE_OFFSET];
+  DBG_CODE{ printf("m = %f, e = %d, seed = %f\n", (double)m, e, (double)y); }
+
+  const ap_ufixpt<2, 2> TWO(2);
+  ap_ufixpt<W_Y, 0> m_t = m;
+#pragma HLS loop unroll
+  for (int i = 0; i < N_ITERATIONS; i++) {
+    ap_ufixpt<W_Y + 1, 1> my = m_t * y;
+    ap_ufixpt<W_Y + 1, 1> t = TWO - my;
+    y = y * t;
+    DBG_CODE{ printf("iteration %d: y = %f\n", i, (double)y); }
+  }
+  return y;
+}
+
+// Returns v * 2^-e rounded to the output type, for E_MIN <= e <= E_MAX. This is
+// done as a constant left shift followed by a single right shift so only one
+// barrel shifter is needed.
+template <unsigned int W_OUT, int IW_OUT, int E_MIN, int E_MAX, unsigned int W, int IW>
+ap_ufixpt<W_OUT, IW_OUT> scale_pow2(ap_ufixpt<W, IW> v, int e) {
+  const int SH_L = (E_MIN < 0) ? -E_MIN : 0;
+  const int SH_R = (E_MAX > 0) ? E_MAX : 0;
+  ap_ufixpt<W + SH_L + SH_R, IW + SH_L> z = v;
+  z <<= SH_L;
+  z >>= (e + SH_L);
+  ap_ufixpt<W_OUT, IW_OUT, hls::AP_RND> result = z;
+  return result;
+}
+
+/***
+ * @function reciprocal
+ * Reciprocal, 1 / x, using a table-seeded Newton-Raphson iteration.
+ *
+ * The input is normalised with a leading-zero count, the top bits index a
+ * small table of 1/m and N_ITERATIONS Newton-Raphson iterations refine the
+ * seed. With the default 8-bit table one iteration gives about 15 bits and two
+ * iterations about 30 bits. There is no divider and no data-dependent loop, so
+ * the function can be pipelined with II=1.
+ * If the input is 0, then an error will occur.
+ *
+ * See utils/generators/recip_gentable.cpp to generate your own table.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} N_ITERATIONS number of Newton-Raphson iterations
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_ufixpt<unsigned int W_IN, int IW_IN>} x input
+ * @param {int|error_status} error variable to hold error code value if an error occurs
+ * @return {ap_ufixpt<unsigned int W_OUT, int IW_OUT>} reciprocal of the input value
+ * @example
+ * hls::ap_ufixpt<10, 4> y = 4;
+ * auto x = hls::math::reciprocal<10, 2, 1>(y); //x will be an ap_ufixpt w/ the value 0.25
+ */
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN, typename E>
+ap_ufixpt<W_OUT, IW_OUT> reciprocal(ap_ufixpt<W_IN, IW_IN> x, E &error) {
+  if (x == 0) {
+    report_error(error, INF_ERROR, "Math Error: result is +inf.\n");
+    return 0;
+  }
+
+  int e;
+  ap_ufixpt<W_OUT + 4, 2> y = reciprocal_normalized<N_ITERATIONS, W_OUT + 4>(x, e);
+  return scale_pow2<W_OUT, IW_OUT, IW_IN - (int)W_IN + 1, IW_IN>(y, e);
+}
+
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
+ap_ufixpt<W_OUT, IW_OUT> reciprocal(ap_ufixpt<W_IN, IW_IN> x) {
+  ignore_error error;
+  return reciprocal<W_OUT, IW_OUT, N_ITERATIONS>(x, error);
+}
+
+/***
+ * @function reciprocal
+ * Signed version of reciprocal.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} N_ITERATIONS number of Newton-Raphson iterations
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x input
+ * @param {int|error_status} error variable to hold error code value if an error occurs
+ * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} reciprocal of the input value
+ * @example
+ * hls::ap_fixpt<10, 4> y = -4;
+ * auto x = hls::math::reciprocal<10, 2, 1>(y); //x will be an ap_fixpt w/ the value -0.25
+ */
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN, typename E>
+ap_fixpt<W_OUT, IW_OUT> reciprocal(ap_fixpt<W_IN, IW_IN> x, E &error) {
+  bool neg = x < 0;
+  ap_ufixpt<W_IN, IW_IN> ax = neg ? ap_fixpt<W_IN + 1, IW_IN + 1>(-x) : ap_fixpt<W_IN + 1, IW_IN + 1>(x);
+  ap_ufixpt<W_OUT - 1, IW_OUT - 1> r = reciprocal<W_OUT - 1, IW_OUT - 1, N_ITERATIONS>(ax, error);
+  ap_fixpt<W_OUT, IW_OUT> result = r;
+  return neg ? ap_fixpt<W_OUT, IW_OUT>(-result) : result;
+}
+
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> reciprocal(ap_fixpt<W_IN, IW_IN> x) {
+  ignore_error error;
+  return reciprocal<W_OUT, IW_OUT, N_ITERATIONS>(x, error);
+}
+
+/***
+ * @function divide
+ * Division, a / b, computed as a times a table-seeded Newton-Raphson reciprocal of b.
+ *
+ * The product with a is taken before the result is denormalised, so the
+ * relative precision of the quotient is the same as that of the reciprocal.
+ * This replaces a full-width divider with a small table, a few multipliers
+ * and a shifter, and can be pipelined with II=1.
+ * If b is 0, then an error will occur.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} N_ITERATIONS number of Newton-Raphson iterations
+ * @template {unsigned int} W_A width of the dividend (automatically inferred)
+ * @template {int} IW_A width of integer portion of the dividend (automatically inferred)
+ * @template {unsigned int} W_B width of the divisor (automatically inferred)
+ * @template {int} IW_B width of integer portion of the divisor (automatically inferred)
+ *
+ * @param {ap_ufixpt<unsigned int W_A, int IW_A>} a dividend
+ * @param {ap_ufixpt<unsigned int W_B, int IW_B>} b divisor
+ * @param {int|error_status} error variable to hold error code value if an error occurs
+ * @return {ap_ufixpt<unsigned int W_OUT, int IW_OUT>} quotient a / b
+ * @example
+ * hls::ap_ufixpt<10, 4> a = 3, b = 4;
+ * auto x = hls::math::divide<10, 2, 1>(a, b); //x will be an ap_ufixpt w/ the value 0.75
+ */
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_A, int IW_A,
+          unsigned int W_B, int IW_B, typename E>
+ap_ufixpt<W_OUT, IW_OUT> divide(ap_ufixpt<W_A, IW_A> a, ap_ufixpt<W_B, IW_B> b,
+                                E &error) {
+  if (b == 0) {
+    report_error(error, INF_ERROR, "Math Error: division by 0.\n");
+    return 0;
+  }
+
+  int e;
+  ap_ufixpt<W_OUT + 4, 2> y = reciprocal_normalized<N_ITERATIONS, W_OUT + 4>(b, e);
+  ap_ufixpt<W_A + W_OUT + 4, IW_A + 2> p = a * y;
+  return scale_pow2<W_OUT, IW_OUT, IW_B - (int)W_B + 1, IW_B>(p, e);
+}
+
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_A, int IW_A,
+          unsigned int W_B, int IW_B>
+ap_ufixpt<W_OUT, IW_OUT> divide(ap_ufixpt<W_A, IW_A> a, ap_ufixpt<W_B, IW_B> b) {
+  ignore_error error;
+  return divide<W_OUT, IW_OUT, N_ITERATIONS>(a, b, error);
+}
+
+/***
+ * @function divide
+ * Signed version of divide.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} N_ITERATIONS number of Newton-Raphson iterations
+ * @template {unsigned int} W_A width of the dividend (automatically inferred)
+ * @template {int} IW_A width of integer portion of the dividend (automatically inferred)
+ * @template {unsigned int} W_B width of the divisor (automatically inferred)
+ * @template {int} IW_B width of integer portion of the divisor (automatically inferred)
+ *
+ * @param {ap_fixpt<unsigned int W_A, int IW_A>} a dividend
+ * @param {ap_fixpt<unsigned int W_B, int IW_B>} b divisor
+ * @param {int|error_status} error variable to hold error code value if an error occurs
+ * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} quotient a / b
+ * @example
+ * hls::ap_fixpt<10, 4> a = -3, b = 4;
+ * auto x = hls::math::divide<10, 2, 1>(a, b); //x will be an ap_fixpt w/ the value -0.75
+ */
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_A, int IW_A,
+          unsigned int W_B, int IW_B, typename E>
+ap_fixpt<W_OUT, IW_OUT> divide(ap_fixpt<W_A, IW_A> a, ap_fixpt<W_B, IW_B> b,
+                               E &error) {
+  bool neg = (a < 0) != (b < 0);
+  ap_ufixpt<W_A, IW_A> aa = (a < 0) ? ap_fixpt<W_A + 1, IW_A + 1>(-a) : ap_fixpt<W_A + 1, IW_A + 1>(a);
+  ap_ufixpt<W_B, IW_B> ab = (b < 0) ? ap_fixpt<W_B + 1, IW_B + 1>(-b) : ap_fixpt<W_B + 1, IW_B + 1>(b);
+  ap_ufixpt<W_OUT - 1, IW_OUT - 1> q = divide<W_OUT - 1, IW_OUT - 1, N_ITERATIONS>(aa, ab, error);
+  ap_fixpt<W_OUT, IW_OUT> result = q;
+  return neg ? ap_fixpt<W_OUT, IW_OUT>(-result) : result;
+}
+
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_A, int IW_A,
+          unsigned int W_B, int IW_B>
+ap_fixpt<W_OUT, IW_OUT> divide(ap_fixpt<W_A, IW_A> a, ap_fixpt<W_B, IW_B> b) {
+  ignore_error error;
+  return divide<W_OUT, IW_OUT, N_ITERATIONS>(a, b, error);
+}
+} // namespace math
+} // namespace hls
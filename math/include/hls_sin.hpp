@@ -24,6 +24,7 @@
 #pragma once
 #include "hls_common.hpp"
 #include "hls_sincos.hpp"
+#include "hls_range_reduction.hpp"
 #include "../utils/generators/generated_tables/sin_lut_table.hpp"
 
 /***
@@ -64,59 +65,29 @@ ap_fixpt<W_OUT, IW_OUT> sin_cordic(ap_fixpt<W_IN, IW_IN> x) {
 // Modified: Made compilable with SHLS.
 // License in licenses folder, disclaimer at the top of header file.
 
-/***
- * @function sin_taylor
- * 2-term Taylor Series implementation of sin.
- *
- * @template {unsigned int} W_OUT width of the output
- * @template {int} IW_OUT width of integer portion of the output
- * @template {unsigned int} W_IN width of the input (automatically inferred)
- * @template {int} IW_IN width of integer portion of the input (automatically inferred)
- *
- * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x angle (in radians)
- * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} sine of input angle
- * @example
- * hls::ap_fixpt<10, 2> y = 3.1415;
- * auto x = hls::math::sin_taylor<10, 2>(y); //x will be an ap_fixpt w/ the value 0
- */
-template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
-ap_fixpt<W_OUT, IW_OUT> sin_taylor(ap_fixpt<W_IN, IW_IN> x) {
+// sin_taylor on an angle already reduced by reduce_quadrant, x = q * pi/2 + r.
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_R>
+ap_fixpt<W_OUT, IW_OUT> sin_taylor_quadrant(ap_ufixpt<W_R, 1> r, ap_uint<2> q) {
 
   int sign = 1;
-  ap_fixpt<W_OUT, IW_OUT> sqr, result;
+  ap_fixpt<W_OUT, IW_OUT> x, sqr, result;
   const ap_fixpt<W_OUT, IW_OUT> SK[2] = {0.008333333333333333333,
                                           0.166666666666666666666};
-  const ap_fixpt<W_OUT, IW_OUT> PI(M_PI);
-  const ap_fixpt<W_OUT, IW_OUT> TWO_PI(2 * M_PI);
   const ap_fixpt<W_OUT, IW_OUT> HALF_PI(M_PI_2);
 
-DBG_CODE{
-  printf("x = %f\n", (double)x);
-}
-
-  // x %= 2PI
-DBG_CODE{
-  printf("x in rad = %f\n", (double)x);
-}
-  ap_fixpt<W_IN, W_IN> div = x / TWO_PI;
-  ap_fixpt<W_IN, IW_IN> div2 = TWO_PI * div;
-  x = x - div2;
+  // 2nd and 4th quadrants: sin(q * pi/2 + r) = +/-sin(pi/2 - r).
+  // 3rd and 4th quadrants: the sign is negative.
+  if (q[0])
+    x = HALF_PI - r;
+  else
+    x = r;
+  if (q[1])
+    sign = -1;
 
 DBG_CODE{
   printf("principle x = %f\n", (double)x);
 }
 
-  if (x < 0)
-    x = PI * 2 + x;
-  if ((x > HALF_PI) && (x <= PI))
-    x = PI - x;
-  else if ((x > PI) && (x <= (PI + HALF_PI))) {
-    x = x - PI;
-    sign = -1;
-  } else if (x > (PI + HALF_PI)) {
-    x = (PI << 1) - x;
-    sign = -1;
-  }
   sqr = x * x;
   result = SK[0];
   result = result * sqr;
@@ -129,69 +100,59 @@ DBG_CODE{
 }
 
 /***
- * @function sin_lut
- * Lookup Table implementation of sin. 
- * Number of decimal bits of input value is recommended to be less than DECIM (defined in utils/generators/generated_tables/sin_lut_table.hpp)
+ * @function sin_taylor
+ * 2-term Taylor Series implementation of sin.
  *
  * @template {unsigned int} W_OUT width of the output
  * @template {int} IW_OUT width of integer portion of the output
  * @template {unsigned int} W_IN width of the input (automatically inferred)
  * @template {int} IW_IN width of integer portion of the input (automatically inferred)
  *
- * See utils/generators/sin_lut_gentable.cpp to generate your own tables.
  * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x angle (in radians)
  * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} sine of input angle
  * @example
  * hls::ap_fixpt<10, 2> y = 3.1415;
- * auto x = hls::math::sin_lut<10, 2>(y); //x will be an ap_fixpt w/ the value 0
+ * auto x = hls::math::sin_taylor<10, 2>(y); //x will be an ap_fixpt w/ the value 0
  */
-
 template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
-ap_fixpt<W_OUT, IW_OUT> sin_lut(ap_fixpt<W_IN, IW_IN> x) {
+ap_fixpt<W_OUT, IW_OUT> sin_taylor(ap_fixpt<W_IN, IW_IN> x) {
 
-  typedef ap_fixpt<2 + W_OUT - IW_OUT, 2> T;
-  const T HALF_PI(M_PI_2);
+DBG_CODE{
+  printf("x = %f\n", (double)x);
+}
 
-  const ap_fixpt<3 + W_OUT - IW_OUT, 3> PI(M_PI);
-  const ap_fixpt<4 + W_OUT - IW_OUT, 4> TWO_PI(2 * M_PI);
-  const ap_fixpt<4 + W_OUT - IW_OUT, 4> THREE_HALVES_PI(3 * M_PI / 2);
+  ap_uint<2> q;
+  ap_ufixpt<W_OUT - IW_OUT + 1, 1> r = reduce_quadrant<W_OUT - IW_OUT + 1>(x, q);
+  return sin_taylor_quadrant<W_OUT, IW_OUT>(r, q);
+}
+
+// sin_lut on an angle already reduced by reduce_quadrant, x = q * pi/2 + r.
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_R>
+ap_fixpt<W_OUT, IW_OUT> sin_lut_quadrant(ap_ufixpt<W_R, 1> r, ap_uint<2> q) {
+
+  typedef ap_fixpt<2 + W_OUT - IW_OUT, 2> T;
+  const ap_ufixpt<W_R + 1, 1> HALF_PI(M_PI_2);
 
   const int DECIM = _HLS_SIN_LUT_DECIM;
   int sign = 1;
-  while (x < 0)
-    x = x + TWO_PI;
-  while (x > TWO_PI)
-    x = x - TWO_PI;
 
-  DBG_CODE{ printf("x = %f\n", (double)x); }
-
-  DBG_CODE {
-	  if (DECIM < (W_IN - IW_IN)) printf("Because DECIM is less than input fractional bits (i.e. DECIM < W_IN - IW_IN), precision will be lost.\nPlease either re-generate sin_lut tables with a larger DECIM, or decrease number of input fractional bits.\n");
-  }
   ap_ufixpt<DECIM + 1, 1> first_quad_x;
 
   // Depending on the quadrant, we wanna find sin(A - B), where (A - B) will
-  // be within [0, PI / 2).
-  if (x < HALF_PI) {
-      first_quad_x = x;
-  } else if (x < PI) {
-      // For 2nd quadrant, sin(x) = sin(PI - x).
-      first_quad_x = PI - x;
-  } else if (x < THREE_HALVES_PI) {
-      // For 3rd quadrant, sin(x) = -sin(x - PI).
-      sign = -1;
-      first_quad_x = x - PI;
-  } else {
-      // For 4th quadrant, sin(x) = -sin(2 * PI - x).
-      sign = -1;
-      first_quad_x = TWO_PI - x;
-  }
+  // be within [0, PI / 2].
+  // For 2nd and 4th quadrants, sin(q * PI / 2 + r) = +/-sin(PI / 2 - r).
+  // For 3rd and 4th quadrants, the sign is negative.
+  if (q[0])
+    first_quad_x = HALF_PI - r;
+  else
+    first_quad_x = r;
+  if (q[1])
+    sign = -1;
 
   DBG_CODE{
     printf("first_quad_x = %f\n", (double)first_quad_x);
   }
 
-
     // Say X = fa + fb, sin(X) = sin(fa + fb)
     //                         = sin(fa) * cos(fb) + cos(fa) * sin(fb)
     // fa will be the upper bits of X and fb wil be the lower bits of X.
@@ -237,5 +198,40 @@ ap_fixpt<W_OUT, IW_OUT> sin_lut(ap_fixpt<W_IN, IW_IN> x) {
   return(sin_result) ;
 
 }
+
+/***
+ * @function sin_lut
+ * Lookup Table implementation of sin. 
+ * Number of decimal bits of input value is recommended to be less than DECIM (defined in utils/generators/generated_tables/sin_lut_table.hpp)
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * See utils/generators/sin_lut_gentable.cpp to generate your own tables.
+ * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x angle (in radians)
+ * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} sine of input angle
+ * @example
+ * hls::ap_fixpt<10, 2> y = 3.1415;
+ * auto x = hls::math::sin_lut<10, 2>(y); //x will be an ap_fixpt w/ the value 0
+ */
+
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> sin_lut(ap_fixpt<W_IN, IW_IN> x) {
+
+  const int DECIM = _HLS_SIN_LUT_DECIM;
+
+  DBG_CODE{ printf("x = %f\n", (double)x); }
+
+  DBG_CODE {
+	  if (DECIM < (W_IN - IW_IN)) printf("Because DECIM is less than input fractional bits (i.e. DECIM < W_IN - IW_IN), precision will be lost.\nPlease either re-generate sin_lut tables with a larger DECIM, or decrease number of input fractional bits.\n");
+  }
+
+  // Fixed latency range reduction, no loops.
+  ap_uint<2> q;
+  ap_ufixpt<SIN_LUT_W_R, 1> r = reduce_quadrant<SIN_LUT_W_R>(x, q);
+  return sin_lut_quadrant<W_OUT, IW_OUT>(r, q);
+}
 }
 }
@@ -21,6 +21,8 @@
 #pragma once
 #include "hls_common.hpp"
 #include "hls_cordic.hpp"
+#include "hls_range_reduction.hpp"
+#include "../utils/generators/generated_tables/sin_lut_table.hpp"
 
 /***
  * @title sincos
@@ -58,17 +60,8 @@ void sincos(ap_fixpt<W_IN, IW_IN> desired_angle, ap_fixpt<W_OUT, IW_OUT>& sin, a
   T y = 0;
   T ZERO(0);
 
-  bool sign = desired_angle[W_IN - 1];
-  // First get angle to be positive:
-  auto abs_in = sign ? ap_fixpt<W_IN, IW_IN>(-desired_angle) : (desired_angle);
-  
-  // Find quadrant & get angle btwn 0 - 90:
-  T r;
-  const ap_ufixpt<W_IN - IW_IN + 1, 1> pi2(M_PI_2); // pi/2
-  const ap_ufixpt<W_IN - IW_IN + 1, 0> pi2_inv(M_2_PI);     // 2/pi
-  ap_uint<IW_IN> q_I = abs_in * pi2_inv;
-  r = abs_in - ap_fixpt<W_IN, IW_IN>(q_I * pi2);
-  q = q_I;
+  // Get the quadrant & an angle btwn 0 - 90, with a fixed latency:
+  T r = reduce_quadrant<W_IN - IW_IN + 1>(desired_angle, q);
 
   DBG_CODE{
   printf("quad = %llu\n", q.to_uint64());
@@ -93,11 +86,89 @@ void sincos(ap_fixpt<W_IN, IW_IN> desired_angle, ap_fixpt<W_OUT, IW_OUT>& sin, a
     cos = y;   // cos(t + 3*pi/2) = sin(t);
   }
 
-  if (sign)
-    sin = -sin;
-
 //   printf("ANGLE: %f: COS = %f, SIN = %f\n\n", (double)desired_angle,
 //   (double)x, (double)y);
 }
+
+// Width of the reduced angle passed to the sin_lut tables. It has a couple of
+// bits more than the table so that only the final conversion truncates.
+const int SIN_LUT_W_R = _HLS_SIN_LUT_DECIM + 3;
+
+// sincos_lut on an angle already reduced by reduce_quadrant, x = q * pi/2 + r.
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_R>
+void sincos_lut_quadrant(ap_ufixpt<W_R, 1> r, ap_uint<2> q, ap_fixpt<W_OUT, IW_OUT>& sin,
+                         ap_fixpt<W_OUT, IW_OUT>& cos) {
+  typedef ap_fixpt<2 + W_OUT - IW_OUT, 2> T;
+  const int DECIM = _HLS_SIN_LUT_DECIM;
+
+  // Same split as sin_lut, r = fa + fb, but both sums of products are taken
+  // from one read of each of the four tables:
+  //   sin(r) = sin(fa) * cos(fb) + cos(fa) * sin(fb)
+  //   cos(r) = cos(fa) * cos(fb) - sin(fa) * sin(fb)
+  const int EXT_W = DECIM + 1;
+  const int fb_width = EXT_W - (EXT_W >> 1);
+
+  ap_ufixpt<DECIM + 1, 1> r_t = r;
+  ap_uint<DECIM + 1> idx = r_t(DECIM, 0);
+  unsigned fa = (unsigned)idx(DECIM, fb_width).to_uint64();
+  unsigned fb = (unsigned)idx(fb_width - 1, 0).to_uint64();
+
+  T sin_fa = sin_fa_lut[fa];
+  T sin_fb = sin_fb_lut[fb];
+  T cos_fa = cos_fa_lut[fa];
+  T cos_fb = cos_fb_lut[fb];
+
+  T s = sin_fa * cos_fb + cos_fa * sin_fb;
+  T c = cos_fa * cos_fb - sin_fa * sin_fb;
+
+  DBG_CODE{
+    printf("fa = %d, fb = %d, sin(r) = %f, cos(r) = %f\n", fa, fb, (double)s, (double)c);
+  }
+
+  if (q == 0) {
+    sin = s;
+    cos = c;
+  } else if (q == 1) {
+    sin = c;
+    cos = -s;
+  } else if (q == 2) {
+    sin = -s;
+    cos = -c;
+  } else {
+    sin = -c;
+    cos = s;
+  }
+}
+
+/***
+ * @function sincos_lut
+ * Lookup Table implementation of sincos.
+ * Both outputs come from one read of each of the sin_lut tables and two
+ * multiply-adds, so this needs half the table reads of calling sin_lut and
+ * cos_lut on the same angle. The range reduction is also shared.
+ * Number of decimal bits of input value is recommended to be less than DECIM (defined in utils/generators/generated_tables/sin_lut_table.hpp)
+ *
+ * See utils/generators/sin_lut_gentable.cpp to generate your own tables.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_fixpt<W_IN, IW_IN>} x angle (in radians)
+ * @param {ap_fixpt<W_OUT, IW_OUT>} sin variable that will hold the value of sine after the function executes
+ * @param {ap_fixpt<W_OUT, IW_OUT>} cos variable that will hold the value of cosine after the function executes
+ * @example
+ * hls::ap_fixpt<16, 2> sin = 0;
+ * hls::ap_fixpt<16, 2> cos = 0;
+ * hls::ap_fixpt<16, 3> x = 3.14;
+ * hls::math::sincos_lut(x, sin, cos);
+ */
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+void sincos_lut(ap_fixpt<W_IN, IW_IN> x, ap_fixpt<W_OUT, IW_OUT>& sin, ap_fixpt<W_OUT, IW_OUT>& cos) {
+  ap_uint<2> q;
+  ap_ufixpt<SIN_LUT_W_R, 1> r = reduce_quadrant<SIN_LUT_W_R>(x, q);
+  sincos_lut_quadrant(r, q, sin, cos);
+}
 }
 }
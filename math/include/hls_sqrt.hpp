@@ -20,6 +20,7 @@
 #pragma once
 
 #include "hls_common.hpp"
+#include "../utils/generators/generated_tables/rsqrt_table.hpp"
 
 /***
  * @title sqrt
@@ -28,37 +29,6 @@
 namespace hls {
 namespace math {
 
-inline unsigned long long nextPowerOf2(unsigned long long n) {
-  n--;
-  n |= n >> 1;
-  n |= n >> 2;
-  n |= n >> 4;
-  n |= n >> 8;
-  n |= n >> 16;
-  n |= n >> 32ull;
-  return ++n;
-}
-
-template <unsigned int IW> inline unsigned int log2Pow(unsigned long long n) {
-  unsigned int l = 1;
-  for (unsigned int i = 0; i < IW; i++) {
-    if (n > 1) {
-      l++;
-      n >>= 1;
-    }
-  }
-  return l;
-}
-
-template <unsigned int W, int IW>
-inline ap_ufixpt<W, IW> fixpt_ceil(ap_ufixpt<W, IW> x) {
-  unsigned short intPart = x(W - 1, W - IW);
-  unsigned short fracPart = x(W - IW - 1, 0);
-  if (fracPart > 0)
-    intPart++;
-  return ap_ufixpt<W, IW>(intPart);
-}
-
 //This is an experimental implementation based on the following article. Here is the link for more information about the algorithm.
 // https://iopscience.iop.org/article/10.1088/1742-6596/1314/1/012008.
 
@@ -86,13 +56,14 @@ ap_ufixpt<W, IW> sqrt(ap_ufixpt<W_IN, IW_IN> val) {
   if (val == 0)
     return 0;
 
-  unsigned long long intPart = val(W_IN - 1, W_IN - IW_IN);
-  unsigned long long npow2 = nextPowerOf2(intPart);
-  unsigned long lg2 = log2Pow<IW_IN>(npow2);
-  ap_ufixpt<W_IN, IW_IN> m = fixpt_ceil<W_IN, IW_IN>(lg2 / 2.0);
+  // val < 2^b, where b is the number of significant integer bits. Shifting by
+  // 2 * ceil(b / 2) brings it below 1 with an even exponent.
+  ap_uint<W_IN> mant = val(W_IN - 1, 0);
+  int b = IW_IN - (int)lzc_normalize<W_IN>(mant);
+  int m = (b > 0) ? (b + 1) >> 1 : 0;
 
   DBG_CODE{
-	printf("x = %f\nintPart = %d\nnpow2 = %d\nlg2 = %d\nm = %f\n", (double)val, intPart, npow2, lg2, (double)m);
+	printf("x = %f\nb = %d\nm = %d\n", (double)val, b, m);
   }
 
   // Variable "A" will be normalized < 1, therefore we're only keeping 1 bit
@@ -110,7 +81,7 @@ ap_ufixpt<W, IW> sqrt(ap_ufixpt<W_IN, IW_IN> val) {
   ap_ufixpt<W + 1, 1> x = 0, c = 0;
   DBG_CODE {
     std::cout << "A:" << (double)A << ", val:" << (double)val
-              << ", m:" << (double)m << std::endl;
+              << ", m:" << m << std::endl;
   }
 
   // #pragma HLS loop pipeline
@@ -140,5 +111,177 @@ ap_ufixpt<W, IW> sqrt(ap_ufixpt<W_IN, IW_IN> val) {
   ap_ufixpt<W, IW, hls::AP_RND> Q = Qtmp;
   return Q;
 }
+
+// Splits a non-zero x into m * 2^(2 * half_exp), with m in [0.25, 1).
+// Keeping the exponent even means sqrt(x) = sqrt(m) * 2^half_exp exactly.
+template <unsigned int W_IN, int IW_IN>
+void sqrt_normalize(ap_ufixpt<W_IN, IW_IN> x, ap_ufixpt<W_IN + 1, 0> &m,
+                    int &half_exp) {
+  ap_uint<W_IN> mant = x(W_IN - 1, 0);
+  int lz = lzc_normalize<W_IN>(mant);
+
+  // mant now has its MSB set, i.e. it is a fraction in [0.5, 1).
+  ap_ufixpt<2 * W_IN, W_IN> wide = mant;
+  m = wide >> W_IN;
+  int e = IW_IN - lz;
+  if (e & 1) {
+    m >>= 1;
+    e += 1;
+  }
+  half_exp = e / 2;
+
+  DBG_CODE{
+    printf("x = %f, lz = %d, m = %f, half_exp = %d\n", (double)x, lz, (double)m, half_exp);
+  }
+}
+
+/***
+ * @function sqrt_nonrestoring
+ * Non-restoring digit-recurrence implementation of sqrt.
+ *
+ * The input is normalised with a leading-zero count so the recurrence only
+ * has to produce as many result bits as the output needs, one bit per
+ * iteration using a single add/subtract. The iterations are fully unrolled
+ * and there are no data-dependent loops, so the function can be pipelined
+ * with II=1.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_ufixpt<unsigned int W_IN, int IW_IN>} x input
+ * @return {ap_ufixpt<unsigned int W_OUT, int IW_OUT>} square root of input value
+ * @example
+ * hls::ap_ufixpt<10, 4> y = 4;
+ * auto x = hls::math::sqrt_nonrestoring<10, 2>(y); //x will be an ap_ufixpt w/ the value 2
+ */
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_ufixpt<W_OUT, IW_OUT> sqrt_nonrestoring(ap_ufixpt<W_IN, IW_IN> x) {
+  const int F_OUT = (int)W_OUT - IW_OUT;
+  // Largest half exponent sqrt_normalize can return (when x has no leading zeros).
+  const int HALF_EXP_MAX = (IW_IN + (IW_IN & 1)) / 2;
+  // Number of result bits: the output fraction, the largest integer part and
+  // one guard bit for rounding.
+  const int N = F_OUT + HALF_EXP_MAX + 1;
+  static_assert(N > 0, "sqrt_nonrestoring: output has no bits to compute.");
+
+  if (x == 0)
+    return 0;
+
+  ap_ufixpt<W_IN + 1, 0> m;
+  int half_exp;
+  sqrt_normalize(x, m, half_exp);
+
+  // Radicand as a 2N-bit integer, D = m * 2^(2N), so that Q = floor(sqrt(D)).
+  ap_ufixpt<2 * N, 0> m_ext = m;
+  ap_uint<2 * N> D = m_ext(2 * N - 1, 0);
+
+  // One result bit per iteration. The partial remainder is allowed to go
+  // negative instead of being restored, so every step is a single add or
+  // subtract selected by the sign of the previous remainder.
+  ap_int<N + 5> R = 0;
+  ap_uint<N> Q = 0;
+#pragma HLS loop unroll
+  for (int i = N - 1; i >= 0; i--) {
+    ap_uint<2> digits = D(2 * i + 1, 2 * i);
+    ap_int<N + 5> Rs = (R << 2) + digits;
+    ap_int<N + 5> Q4 = ap_int<N + 5>(Q) << 2;
+    if (R >= 0)
+      R = Rs - (Q4 + 1);
+    else
+      R = Rs + (Q4 + 3);
+    Q = (Q << 1) | ap_uint<N>(R >= 0);
+    DBG_CODE{ printf("i = %d, R = %lld, Q = %llu\n", i, R.to_int64(), Q.to_uint64()); }
+  }
+
+  // Q holds sqrt(m) with N fractional bits. Scale it by 2^half_exp and round
+  // to F_OUT fractional bits. The shift is always to the right by at least 1.
+  const int sh = HALF_EXP_MAX + 1 - half_exp;
+  ap_uint<N + 1> Qr = ((ap_uint<N + 1>(Q) >> (sh - 1)) + 1) >> 1;
+  ap_ufixpt<N + 1 + F_OUT, N + 1> result = Qr;
+  return result >> F_OUT;
+}
+
+/***
+ * @function rsqrt
+ * Reciprocal square root, 1 / sqrt(x), using a table-seeded Newton-Raphson iteration.
+ *
+ * The input is normalised to m * 2^(2 * e) with m in [0.25, 1). The top bits
+ * of m index a small table of 1/sqrt(m) which is then refined with
+ * N_ITERATIONS iterations of y = y * (3 - m * y^2) / 2. Each iteration roughly
+ * doubles the number of correct bits, so with the default 8-bit table one
+ * iteration gives about 15 bits and two iterations about 30 bits.
+ * There are no data-dependent loops, so the function can be pipelined with II=1.
+ * If the input is 0, then an error will occur and 0 is returned. A result too
+ * large for the output type, e.g. for very small inputs, saturates to its
+ * largest value.
+ *
+ * See utils/generators/rsqrt_gentable.cpp to generate your own table.
+ *
+ * @template {unsigned int} W_OUT width of the output
+ * @template {int} IW_OUT width of integer portion of the output
+ * @template {int} N_ITERATIONS number of Newton-Raphson iterations
+ * @template {unsigned int} W_IN width of the input (automatically inferred)
+ * @template {int} IW_IN width of integer portion of the input (automatically inferred)
+ *
+ * @param {ap_ufixpt<unsigned int W_IN, int IW_IN>} x input
+ * @param {int|error_status} error variable to hold error code value if an error occurs
+ * @return {ap_ufixpt<unsigned int W_OUT, int IW_OUT>} reciprocal of the square root of the input value
+ * @example
+ * hls::ap_ufixpt<10, 4> y = 4;
+ * auto x = hls::math::rsqrt<10, 2, 1>(y); //x will be an ap_ufixpt w/ the value 0.5
+ */
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN, typename E>
+ap_ufixpt<W_OUT, IW_OUT> rsqrt(ap_ufixpt<W_IN, IW_IN> x, E &error) {
+  // 1/sqrt(m) is in (1, 2] for m in [0.25, 1).
+  typedef ap_ufixpt<W_OUT + 4, 2> T;
+  // Range of half exponents returned by sqrt_normalize.
+  const int E_MAX = IW_IN + (IW_IN & 1);
+  const int E_MIN = IW_IN - (int)W_IN + 1 + ((IW_IN - (int)W_IN + 1) & 1);
+  const int SH_L = (E_MIN < 0) ? -E_MIN / 2 : 0;
+  const int SH_R = (E_MAX > 0) ? E_MAX / 2 : 0;
+
+  if (x == 0) {
+    report_error(error, INF_ERROR, "Math Error: result is +inf.\n");
+    return 0;
+  }
+
+  ap_ufixpt<W_IN + 1, 0> m;
+  int half_exp;
+  sqrt_normalize(x, m, half_exp);
+
+  // Seed from the top RSQRT_TABLE_BITS bits of m. Since m >= 0.25 the lowest
+  // quarter of the index range is never used, so it is not stored.
+  ap_ufixpt<RSQRT_TABLE_BITS, 0> m_hi = m;
+  ap_uint<RSQRT_TABLE_BITS> idx = m_hi(RSQRT_TABLE_BITS - 1, 0);
+  T y = rsqrtTable[idx - RSQRT_TABLE_OFFSET];
+  DBG_CODE{ printf("m = %f, idx = %llu, seed = %f\n", (double)m, idx.to_uint64(), (double)y); }
+
+  const ap_ufixpt<2, 2> THREE(3);
+  ap_ufixpt<W_OUT + 4, 0> m_t = m;
+#pragma HLS loop unroll
+  for (int i = 0; i < N_ITERATIONS; i++) {
+    ap_ufixpt<W_OUT + 5, 3> y2 = y * y;
+    ap_ufixpt<W_OUT + 5, 2> my2 = m_t * y2;
+    ap_ufixpt<W_OUT + 5, 2> t = THREE - my2;
+    y = (y * t) >> 1;
+    DBG_CODE{ printf("iteration %d: y = %f\n", i, (double)y); }
+  }
+
+  // result = y * 2^-half_exp, done as a constant left shift followed by a
+  // single right shift so only one barrel shifter is needed.
+  ap_ufixpt<W_OUT + 4 + SH_L + SH_R, 2 + SH_L> z = y;
+  z <<= SH_L;
+  z >>= (half_exp + SH_L);
+  ap_ufixpt<W_OUT, IW_OUT, hls::AP_RND, hls::AP_SAT> result = z;
+  return result;
+}
+
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
+ap_ufixpt<W_OUT, IW_OUT> rsqrt(ap_ufixpt<W_IN, IW_IN> x) {
+  ignore_error error;
+  return rsqrt<W_OUT, IW_OUT, N_ITERATIONS>(x, error);
+}
 } // namespace math
 } // namespace hls
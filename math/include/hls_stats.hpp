@@ -0,0 +1,366 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#pragma once
+#include "hls_common.hpp"
+#include "hls_reciprocal.hpp"
+#include "hls_matrix.hpp"
+#include "hls/streaming.hpp"
+
+/***
+ * @title stats
+ */
+
+namespace hls {
+namespace math {
+
+/***
+ * @function stats_acc
+ * Running count, sum, sum of squares, minimum and maximum of a window of
+ * ap_fixpt<W, IW> samples. The sums are exact, so the variance computed from
+ * them by stats_finalize does not suffer from cancellation and no division is
+ * needed per sample, unlike Welford's update. Up to 2^CNT_W - 1 samples can be
+ * accumulated without overflow.
+ *
+ * @template {unsigned int} W width of the samples
+ * @template {int} IW width of integer portion of the samples
+ * @template {int} CNT_W width of the sample counter
+ */
+template <unsigned int W, int IW, int CNT_W> struct stats_acc {
+  typedef ap_fixpt<W, IW> value_type;
+  typedef ap_uint<CNT_W> count_type;
+  typedef ap_fixpt<W + CNT_W, IW + CNT_W> sum_type;
+  typedef ap_ufixpt<2 * W - 1 + CNT_W, 2 * IW - 1 + CNT_W> sum_sq_type;
+
+  count_type count;
+  sum_type sum;
+  sum_sq_type sum_sq;
+  value_type min, max;
+
+  void reset() {
+    count = 0;
+    sum = 0;
+    sum_sq = 0;
+    // Empty-window identities: the largest and the smallest representable value.
+    min(W - 1, 0) = ~ap_uint<W>(0) >> 1;
+    max(W - 1, 0) = ap_uint<W>(1) << (W - 1);
+  }
+
+  void update(value_type x) {
+    count++;
+    sum += x;
+    sum_sq += x * x;
+    min = (x < min) ? x : min;
+    max = (x > max) ? x : max;
+  }
+
+  // Adds NPPC samples at once. The lanes are reduced first so there is still
+  // only one adder on the loop-carried path.
+  template <int NPPC> void update(const vec<value_type, NPPC> &x) {
+    const int G = bit_width(NPPC);
+    ap_fixpt<W + G, IW + G> s = 0;
+    ap_ufixpt<2 * W - 1 + G, 2 * IW - 1 + G> s2 = 0;
+    value_type lo = min, hi = max;
+#pragma HLS loop unroll
+    for (int i = 0; i < NPPC; i++) {
+      s += x[i];
+      s2 += x[i] * x[i];
+      lo = (x[i] < lo) ? x[i] : lo;
+      hi = (x[i] > hi) ? x[i] : hi;
+    }
+    count += NPPC;
+    sum += s;
+    sum_sq += s2;
+    min = lo;
+    max = hi;
+  }
+
+  // Combines the statistics of two disjoint windows, e.g. two tiles of a frame.
+  void merge(const stats_acc &o) {
+    count += o.count;
+    sum += o.sum;
+    sum_sq += o.sum_sq;
+    min = (o.min < min) ? o.min : min;
+    max = (o.max > max) ? o.max : max;
+  }
+};
+
+/***
+ * @function stats_result
+ * Statistics of one window as produced by stats_finalize. The variance is the
+ * population variance. It has W_OUT bits like the mean, with enough integer
+ * bits for the largest variance of ap_fixpt<W, IW> samples, so it never
+ * overflows.
+ *
+ * @template {unsigned int} W_OUT width of the mean and the variance
+ * @template {int} IW_OUT width of integer portion of the mean
+ * @template {unsigned int} W width of the samples
+ * @template {int} IW width of integer portion of the samples
+ * @template {int} CNT_W width of the sample counter
+ */
+template <unsigned int W_OUT, int IW_OUT, unsigned int W, int IW, int CNT_W>
+struct stats_result {
+  ap_uint<CNT_W> count;
+  ap_fixpt<W + CNT_W, IW + CNT_W> sum;
+  ap_fixpt<W, IW> min, max;
+  ap_fixpt<W_OUT, IW_OUT> mean;
+  ap_ufixpt<W_OUT, 2 * IW - 1> variance;
+};
+
+/***
+ * @function stats_finalize
+ * Computes the mean and the variance of a window from its stats_acc, as
+ * mean = sum / n and variance = (n * sum_sq - sum^2) / n^2. The numerator of
+ * the variance is exact. All three divisions by n use the same table-seeded
+ * reciprocal (see divide), so this is one small table, a few multipliers and
+ * shifters, done once per window.
+ * If the window is empty, then an error will occur.
+ *
+ * @template {unsigned int} W_OUT width of the mean and the variance
+ * @template {int} IW_OUT width of integer portion of the mean
+ * @template {int} N_ITERATIONS number of Newton-Raphson iterations of the divisions
+ * @template {unsigned int} W width of the samples (automatically inferred)
+ * @template {int} IW width of integer portion of the samples (automatically inferred)
+ * @template {int} CNT_W width of the sample counter (automatically inferred)
+ *
+ * @param {stats_acc<W, IW, CNT_W>} acc accumulated statistics
+ * @param {int|error_status} error variable to hold error code value if an error occurs
+ * @return {stats_result<W_OUT, IW_OUT, W, IW, CNT_W>} statistics of the window
+ * @example
+ * hls::math::stats_acc<16, 8, 8> acc;
+ * acc.reset();
+ * acc.update(1); acc.update(2); acc.update(6);
+ * auto s = hls::math::stats_finalize<32, 16, 2>(acc); // s.mean = 3, s.variance = 4.66666
+ */
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W, int IW, int CNT_W,
+          typename E>
+stats_result<W_OUT, IW_OUT, W, IW, CNT_W> stats_finalize(const stats_acc<W, IW, CNT_W> &acc,
+                                                         E &error) {
+  stats_result<W_OUT, IW_OUT, W, IW, CNT_W> r;
+  r.count = acc.count;
+  r.sum = acc.sum;
+  r.min = acc.min;
+  r.max = acc.max;
+  if (acc.count == 0) {
+    report_error(error, INF_ERROR, "Math Error: statistics of an empty window.\n");
+    r.mean = 0;
+    r.variance = 0;
+    return r;
+  }
+
+  // One reciprocal of n is shared by the mean and both steps of the variance.
+  ap_ufixpt<CNT_W, CNT_W> n = acc.count;
+  int e;
+  ap_ufixpt<W_OUT + 4, 2> y = reciprocal_normalized<N_ITERATIONS, W_OUT + 4>(n, e);
+
+  typedef ap_ufixpt<W + CNT_W, IW + CNT_W> MAG;
+  bool neg = acc.sum < 0;
+  MAG s = neg ? ap_fixpt<W + CNT_W + 1, IW + CNT_W + 1>(-acc.sum)
+              : ap_fixpt<W + CNT_W + 1, IW + CNT_W + 1>(acc.sum);
+  ap_ufixpt<W + CNT_W + W_OUT + 4, IW + CNT_W + 2> q = s * y;
+  ap_fixpt<W_OUT, IW_OUT> mean = scale_pow2<W_OUT - 1, IW_OUT - 1, 1, CNT_W>(q, e);
+  r.mean = neg ? ap_fixpt<W_OUT, IW_OUT>(-mean) : mean;
+
+  // d = n * sum_sq - sum^2 is exact and >= 0 (Cauchy-Schwarz). d / n = n * var
+  // is kept with CNT_W extra integer bits before the second division.
+  const int W_D = 2 * W - 1 + 2 * CNT_W, IW_D = 2 * IW - 1 + 2 * CNT_W;
+  const int IW_V = 2 * IW - 1;
+  ap_ufixpt<W_D, IW_D> n_sq = acc.sum_sq * acc.count;
+  ap_ufixpt<W_D, IW_D> s_sq = acc.sum * acc.sum;
+  ap_ufixpt<W_D, IW_D> d = n_sq - s_sq;
+  ap_ufixpt<W_D + W_OUT + 4, IW_D + 2> q_d = d * y;
+  ap_ufixpt<W_OUT + 4 + CNT_W, IW_V + CNT_W> nv =
+      scale_pow2<W_OUT + 4 + CNT_W, IW_V + CNT_W, 1, CNT_W>(q_d, e);
+  ap_ufixpt<2 * W_OUT + 8 + CNT_W, IW_V + CNT_W + 2> q_v = nv * y;
+  r.variance = scale_pow2<W_OUT, IW_V, 1, CNT_W>(q_v, e);
+  return r;
+}
+
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W, int IW, int CNT_W>
+stats_result<W_OUT, IW_OUT, W, IW, CNT_W> stats_finalize(const stats_acc<W, IW, CNT_W> &acc) {
+  ignore_error error;
+  return stats_finalize<W_OUT, IW_OUT, N_ITERATIONS>(acc, error);
+}
+
+/***
+ * @function stats_stream
+ * Reads n_windows windows of `window` words of NPPC samples, one word per
+ * clock cycle (II=1), and writes the statistics of each window when its last
+ * word arrives. With a frame as the window, the host only reads one result per
+ * frame instead of dividing raw sums itself.
+ *
+ * @template {unsigned int} W_OUT width of the mean
+ * @template {int} IW_OUT width of integer portion of the mean
+ * @template {int} CNT_W width of the sample counter, at least log2(window * NPPC + 1)
+ * @template {int} N_ITERATIONS number of Newton-Raphson iterations of the divisions
+ * @template {unsigned int} W width of the samples (automatically inferred)
+ * @template {int} IW width of integer portion of the samples (automatically inferred)
+ * @template {int} NPPC number of samples per word (automatically inferred)
+ *
+ * @param {hls::FIFO<vec<ap_fixpt<W, IW>, NPPC>>} in input samples
+ * @param {hls::FIFO<stats_result<W_OUT, IW_OUT, W, IW, CNT_W>>} out statistics, one per window
+ * @param {int} window number of words per window
+ * @param {int} n_windows number of windows
+ * @param {int|error_status} error variable to hold error code value if an error occurs
+ */
+template <unsigned int W_OUT, int IW_OUT, int CNT_W, int N_ITERATIONS, unsigned int W, int IW,
+          int NPPC, typename E>
+void stats_stream(hls::FIFO<vec<ap_fixpt<W, IW>, NPPC>> &in,
+                  hls::FIFO<stats_result<W_OUT, IW_OUT, W, IW, CNT_W>> &out, int window,
+                  int n_windows, E &error) {
+  stats_acc<W, IW, CNT_W> acc;
+  acc.reset();
+  int k = 0;
+#pragma HLS loop pipeline II(1)
+  for (int i = 0; i < window * n_windows; i++) {
+    acc.update(in.read());
+    if (++k == window) {
+      out.write(stats_finalize<W_OUT, IW_OUT, N_ITERATIONS>(acc, error));
+      acc.reset();
+      k = 0;
+    }
+  }
+}
+
+template <unsigned int W_OUT, int IW_OUT, int CNT_W, int N_ITERATIONS, unsigned int W, int IW,
+          int NPPC>
+void stats_stream(hls::FIFO<vec<ap_fixpt<W, IW>, NPPC>> &in,
+                  hls::FIFO<stats_result<W_OUT, IW_OUT, W, IW, CNT_W>> &out, int window,
+                  int n_windows) {
+  ignore_error error;
+  stats_stream<W_OUT, IW_OUT, CNT_W, N_ITERATIONS>(in, out, window, n_windows, error);
+}
+
+// Histogram bin of x: the top BIN_BITS bits of x with its sign bit flipped, so
+// that the bins are in increasing order of value.
+template <int BIN_BITS, unsigned int W, int IW>
+ap_uint<BIN_BITS> percentile_bin(ap_fixpt<W, IW> x) {
+  ap_uint<W> u = x(W - 1, 0);
+  u[W - 1] = !u[W - 1];
+  return u(W - 1, W - BIN_BITS);
+}
+
+// Smallest value of bin b, the inverse of percentile_bin.
+template <int BIN_BITS, unsigned int W, int IW>
+ap_fixpt<W, IW> percentile_value(ap_uint<BIN_BITS> b) {
+  ap_uint<W> u = 0;
+  u(W - 1, W - BIN_BITS) = b;
+  u[W - 1] = !u[W - 1];
+  ap_fixpt<W, IW> x;
+  x(W - 1, 0) = u;
+  return x;
+}
+
+/***
+ * @function percentile_stream
+ * Approximate percentiles of n_windows windows of `window` words of NPPC
+ * samples. The samples are binned by their top BIN_BITS bits into one
+ * histogram per lane, at one word per clock cycle (II=1); back-to-back hits on
+ * the same bin are forwarded in registers, as in hls::vision::Histogram. After
+ * the last word of a window, the histograms are scanned once (2^BIN_BITS clock
+ * cycles, e.g. during vertical blanking) and cleared, and for each requested
+ * fraction q the smallest value of the bin holding the ceil(q * n)-th smallest
+ * sample is written out. The result is therefore exact to one bin width.
+ *
+ * @template {int} BIN_BITS number of histogram bins is 2^BIN_BITS
+ * @template {int} CNT_W width of the bin counters, at least log2(window * NPPC + 1)
+ * @template {unsigned int} W width of the samples (automatically inferred)
+ * @template {int} IW width of integer portion of the samples (automatically inferred)
+ * @template {int} NPPC number of samples per word (automatically inferred)
+ * @template {int} NP number of percentiles (automatically inferred)
+ * @template {unsigned int} W_Q width of the fractions (automatically inferred)
+ *
+ * @param {hls::FIFO<vec<ap_fixpt<W, IW>, NPPC>>} in input samples
+ * @param {hls::FIFO<vec<ap_fixpt<W, IW>, NP>>} out percentiles, one vec per window
+ * @param {vec<ap_ufixpt<W_Q, 0>, NP>} q fractions in [0, 1), e.g. 0.5 for the median
+ * @param {int} window number of words per window
+ * @param {int} n_windows number of windows
+ */
+template <int BIN_BITS, int CNT_W, unsigned int W, int IW, int NPPC, int NP, unsigned int W_Q>
+void percentile_stream(hls::FIFO<vec<ap_fixpt<W, IW>, NPPC>> &in,
+                       hls::FIFO<vec<ap_fixpt<W, IW>, NP>> &out,
+                       const vec<ap_ufixpt<W_Q, 0>, NP> &q, int window, int n_windows) {
+  static_assert(BIN_BITS <= (int)W, "percentile_stream: more bins than sample values");
+  const int BINS = 1 << BIN_BITS;
+  static ap_uint<CNT_W> hist[NPPC][BINS];
+#pragma HLS memory partition variable(hist) type(complete) dim(1)
+
+  // Rank of each percentile, ceil(q * n), at least 1.
+  ap_uint<CNT_W> n = window * NPPC;
+  ap_uint<CNT_W> rank[NP];
+#pragma HLS loop unroll
+  for (int p = 0; p < NP; p++) {
+    ap_ufixpt<W_Q + CNT_W, CNT_W> t = q[p] * n;
+    ap_uint<CNT_W> r = t(W_Q + CNT_W - 1, W_Q);
+    if (t(W_Q - 1, 0) != 0 || r == 0)
+      r++;
+    rank[p] = r;
+  }
+
+  for (int w = 0; w < n_windows; w++) {
+    // The histograms are all zero at the start of a window.
+    ap_uint<BIN_BITS> prev_bin[NPPC];
+    ap_uint<CNT_W> prev_val[NPPC];
+#pragma HLS loop unroll
+    for (int l = 0; l < NPPC; l++) {
+      prev_bin[l] = 0;
+      prev_val[l] = 0;
+    }
+
+#pragma HLS loop pipeline
+#pragma HLS loop dependence variable(hist) type(inter) direction(RAW) dependent(false)
+    for (int i = 0; i < window; i++) {
+      vec<ap_fixpt<W, IW>, NPPC> x = in.read();
+#pragma HLS loop unroll
+      for (int l = 0; l < NPPC; l++) {
+        ap_uint<BIN_BITS> b = percentile_bin<BIN_BITS>(x[l]);
+        ap_uint<CNT_W> v = hist[l][b];
+        if (b == prev_bin[l])
+          v = prev_val[l];
+        v++;
+        hist[l][b] = v;
+        prev_bin[l] = b;
+        prev_val[l] = v;
+      }
+    }
+
+    vec<ap_fixpt<W, IW>, NP> result;
+    ap_uint<CNT_W> cum = 0;
+#pragma HLS loop pipeline II(1)
+    for (int b = 0; b < BINS; b++) {
+      ap_uint<CNT_W> c = cum;
+#pragma HLS loop unroll
+      for (int l = 0; l < NPPC; l++) {
+        c += hist[l][b];
+        hist[l][b] = 0;
+      }
+#pragma HLS loop unroll
+      for (int p = 0; p < NP; p++) {
+        if (cum < rank[p] && c >= rank[p])
+          result[p] = percentile_value<BIN_BITS, W, IW>(b);
+      }
+      cum = c;
+    }
+    out.write(result);
+  }
+}
+
+} // namespace math
+} // namespace hls
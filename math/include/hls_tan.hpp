@@ -48,28 +48,31 @@ namespace math{
  * @template {int} IW_IN width of integer portion of the input (automatically inferred)
  *
  * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x angle (in radians)
- * @param {int} error variable to hold error code value if an error occurs
+ * @param {int|error_status} error variable to hold error code value if an error occurs
  * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} tangent of input angle
  * @example
  * hls::ap_fixpt<10, 2> y = 3.1415;
  * auto x = hls::math::tan_cordic<10, 2, 16>(y); //x will be an ap_fixpt w/ the value 0
  */	
-template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
-ap_fixpt<W_OUT, IW_OUT> tan_cordic(ap_fixpt<W_IN, IW_IN> desired_angle, int& error = DEFAULT_ERROR) {
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN, typename E>
+ap_fixpt<W_OUT, IW_OUT> tan_cordic(ap_fixpt<W_IN, IW_IN> desired_angle, E &error) {
   ap_fixpt<W_OUT, IW_OUT> fp_sin;
   ap_fixpt<W_OUT, IW_OUT> fp_cos;
   sincos<N_ITERATIONS>(desired_angle, fp_sin, fp_cos);
   if (fp_cos == 0){
-#ifndef __SYNTHESIS__
-    printf("Math Error: tan is +/-inf.\n");
-#endif
-    error = INF_ERROR;
+    report_error(error, INF_ERROR, "Math Error: tan is +/-inf.\n");
     return (0);
   }
 
   return fp_sin/fp_cos;
 }
 
+template <unsigned int W_OUT, int IW_OUT, int N_ITERATIONS, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> tan_cordic(ap_fixpt<W_IN, IW_IN> desired_angle) {
+  ignore_error error;
+  return tan_cordic<W_OUT, IW_OUT, N_ITERATIONS>(desired_angle, error);
+}
+
 // Implementation adapted from https://sourceforge.net/projects/fixedptc/
 // Modified: Made compilable with SHLS.
 // License in licenses folder, disclaimer at the top of header file.
@@ -84,31 +87,37 @@ ap_fixpt<W_OUT, IW_OUT> tan_cordic(ap_fixpt<W_IN, IW_IN> desired_angle, int& err
  * @template {int} IW_IN width of integer portion of the input (automatically inferred)
  *
  * @param {ap_fixpt<unsigned int W_IN, int IW_IN>} x angle (in radians)
- * @param {int} error variable to hold error code value if an error occurs
+ * @param {int|error_status} error variable to hold error code value if an error occurs
  * @return {ap_fixpt<unsigned int W_OUT, int IW_OUT>} tangent of input angle
  * @example
  * hls::ap_fixpt<10, 2> y = 3.1415;
  * auto x = hls::math::tan_taylor<10, 2>(y); //x will be an ap_fixpt w/ the value 0
  */
-template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
-ap_fixpt<W_OUT, IW_OUT> tan_taylor(ap_fixpt<W_IN, IW_IN> x, int& error = DEFAULT_ERROR) {
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN, typename E>
+ap_fixpt<W_OUT, IW_OUT> tan_taylor(ap_fixpt<W_IN, IW_IN> x, E &error) {
 
-  ap_fixpt<W_OUT, IW_OUT> fp_sin = sin_taylor<W_OUT, IW_OUT>(x);
-  ap_fixpt<W_OUT, IW_OUT> fp_cos = cos_taylor<W_OUT, IW_OUT>(x);
+  // Reduce once and share it between sin and cos.
+  ap_uint<2> q;
+  ap_ufixpt<W_OUT - IW_OUT + 1, 1> r = reduce_quadrant<W_OUT - IW_OUT + 1>(x, q);
+  ap_fixpt<W_OUT, IW_OUT> fp_sin = sin_taylor_quadrant<W_OUT, IW_OUT>(r, q);
+  ap_fixpt<W_OUT, IW_OUT> fp_cos = sin_taylor_quadrant<W_OUT, IW_OUT>(r, ap_uint<2>(q + 1));
   if (fp_cos == 0){
-#ifndef __SYNTHESIS__
-    printf("Math Error: tan is +/-inf.\n");
-#endif
-    error = INF_ERROR;
+    report_error(error, INF_ERROR, "Math Error: tan is +/-inf.\n");
     return (0);
   }
   return fp_sin/fp_cos;
  
 }
 
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> tan_taylor(ap_fixpt<W_IN, IW_IN> x) {
+  ignore_error error;
+  return tan_taylor<W_OUT, IW_OUT>(x, error);
+}
+
 /***
  * @function tan_lut
- * Lookup Table implementation of tan based on sin_lut and cos_lut.
+ * Lookup Table implementation of tan based on sincos_lut.
  * Number of decimal bits of input value is recommended to be less than DECIM (defined in utils/generators/generated_tables/sin_lut_table.hpp)
  *
  * @template {unsigned int} W_OUT width of the output
@@ -123,20 +132,26 @@ ap_fixpt<W_OUT, IW_OUT> tan_taylor(ap_fixpt<W_IN, IW_IN> x, int& error = DEFAULT
  * hls::ap_fixpt<10, 2> y = 3.1415;
  * auto x = hls::math::tan_lut<10, 2>(y); //x will be an ap_fixpt w/ the value 0
  */
-template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
-ap_fixpt<W_OUT, IW_OUT> tan_lut(ap_fixpt<W_IN, IW_IN> x, int& error = DEFAULT_ERROR){
-  ap_fixpt<W_OUT, IW_OUT> fp_sin  = sin_lut<W_OUT, IW_OUT>(x);
-  ap_fixpt<W_OUT, IW_OUT> fp_cos = cos_lut<W_OUT, IW_OUT>(x);
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN, typename E>
+ap_fixpt<W_OUT, IW_OUT> tan_lut(ap_fixpt<W_IN, IW_IN> x, E &error) {
+  // Reduce once and share it between sin and cos.
+  ap_uint<2> q;
+  ap_ufixpt<SIN_LUT_W_R, 1> r = reduce_quadrant<SIN_LUT_W_R>(x, q);
+  ap_fixpt<W_OUT, IW_OUT> fp_sin, fp_cos;
+  sincos_lut_quadrant(r, q, fp_sin, fp_cos);
   if (fp_cos == 0){
-#ifndef __SYNTHESIS__
-    printf("Math Error: tan is +/-inf.\n");
-#endif
-    error = INF_ERROR;
+    report_error(error, INF_ERROR, "Math Error: tan is +/-inf.\n");
     return (0);
   }
   return fp_sin/fp_cos;
  
 }
+
+template <unsigned int W_OUT, int IW_OUT, unsigned int W_IN, int IW_IN>
+ap_fixpt<W_OUT, IW_OUT> tan_lut(ap_fixpt<W_IN, IW_IN> x) {
+  ignore_error error;
+  return tan_lut<W_OUT, IW_OUT>(x, error);
+}
 } //namespace math
 } // namespace hls
 
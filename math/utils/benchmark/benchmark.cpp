@@ -0,0 +1,272 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+// Accuracy and throughput benchmark for the math library.
+//
+// Every registered implementation is evaluated over an input range for each
+// W/IW configuration, spread across all cores. When the range holds no more
+// than --max-points representable inputs every one of them is tested,
+// otherwise the range is sampled uniformly. For each implementation the max
+// and mean error in ULPs of the output format are reported, together with the
+// number of software-model evaluations per second, as CSV or JSON.
+//
+// Use --budget to list, for every function and configuration, the fastest
+// implementation that stays within a max ULP error budget.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../sweep.hpp"
+
+// CORDIC iterations used by every CORDIC based implementation. The angle
+// tables hold 16 entries, so more iterations would not improve accuracy.
+#define N_CORDIC 16
+// Newton-Raphson iterations after the table seed (rsqrt, reciprocal, divide).
+#define N_NEWTON 2
+
+/* The implementations under test (impl::), their references (ref_*), the
+ * input sampling and the threaded sweep are in ../sweep.hpp, which the
+ * precision tool shares. Implementations without iterations are passed
+ * N = 0. */
+
+struct Case {
+  const char *function;  // function being approximated, e.g. "sin"
+  const char *impl;      // implementation, e.g. "sin_lut"
+  unsigned int W;
+  int IW;
+  bool is_unsigned;      // inputs are ap_ufixpt
+  int arity;
+  double lo[2], hi[2];   // input range of each argument
+  dut_fn ref, dut;
+};
+
+struct Result {
+  long count = 0, skipped = 0;
+  double max_ulp = 0, sum_ulp = 0, worst_a = 0, worst_b = 0;
+  double seconds = 0;
+};
+
+template <unsigned int W, int IW>
+void add_config(std::vector<Case> &cases) {
+  const double PI = M_PI;
+  cases.push_back({"sin", "sin_lut", W, IW, false, 1, {-2 * PI}, {2 * PI}, ref_sin, impl::sin_lut<W, IW, 0>});
+  cases.push_back({"sin", "sin_cordic", W, IW, false, 1, {-2 * PI}, {2 * PI}, ref_sin, impl::sin_cordic<W, IW, N_CORDIC>});
+  cases.push_back({"sin", "sin_taylor", W, IW, false, 1, {-2 * PI}, {2 * PI}, ref_sin, impl::sin_taylor<W, IW, 0>});
+  cases.push_back({"sin", "sincos", W, IW, false, 1, {-2 * PI}, {2 * PI}, ref_sin, impl::sincos_sin<W, IW, N_CORDIC>});
+  cases.push_back({"sin", "sincos_lut", W, IW, false, 1, {-2 * PI}, {2 * PI}, ref_sin, impl::sincos_lut_sin<W, IW, 0>});
+  cases.push_back({"cos", "cos_lut", W, IW, false, 1, {-2 * PI}, {2 * PI}, ref_cos, impl::cos_lut<W, IW, 0>});
+  cases.push_back({"cos", "cos_cordic", W, IW, false, 1, {-2 * PI}, {2 * PI}, ref_cos, impl::cos_cordic<W, IW, N_CORDIC>});
+  cases.push_back({"cos", "cos_taylor", W, IW, false, 1, {-2 * PI}, {2 * PI}, ref_cos, impl::cos_taylor<W, IW, 0>});
+  cases.push_back({"cos", "sincos", W, IW, false, 1, {-2 * PI}, {2 * PI}, ref_cos, impl::sincos_cos<W, IW, N_CORDIC>});
+  cases.push_back({"cos", "sincos_lut", W, IW, false, 1, {-2 * PI}, {2 * PI}, ref_cos, impl::sincos_lut_cos<W, IW, 0>});
+  cases.push_back({"tan", "tan_lut", W, IW, false, 1, {-1.4}, {1.4}, ref_tan, impl::tan_lut<W, IW, 0>});
+  cases.push_back({"tan", "tan_cordic", W, IW, false, 1, {-1.4}, {1.4}, ref_tan, impl::tan_cordic<W, IW, N_CORDIC>});
+  cases.push_back({"tan", "tan_taylor", W, IW, false, 1, {-1.4}, {1.4}, ref_tan, impl::tan_taylor<W, IW, 0>});
+  cases.push_back({"exp", "exp_taylor", W, IW, false, 1, {-8}, {8}, ref_exp, impl::exp_taylor<W, IW, 0>});
+  cases.push_back({"exp", "exp_cordic", W, IW, false, 1, {-8}, {8}, ref_exp, impl::exp_cordic<W, IW, N_CORDIC>});
+  cases.push_back({"exp", "exp_lut", W, IW, false, 1, {-8}, {8}, ref_exp, impl::exp_lut<W, IW, 0>});
+  cases.push_back({"ln", "ln_lut", W, IW, true, 1, {0.01}, {100}, ref_ln, impl::ln_lut<W, IW, 0>});
+  cases.push_back({"ln", "ln_cordic", W, IW, true, 1, {0.01}, {100}, ref_ln, impl::ln_cordic<W, IW, N_CORDIC>});
+  cases.push_back({"log2", "log2_lut", W, IW, true, 1, {0.01}, {100}, ref_log2, impl::log2_lut<W, IW, 0>});
+  cases.push_back({"log2", "log2_cordic", W, IW, true, 1, {0.01}, {100}, ref_log2, impl::log2_cordic<W, IW, N_CORDIC>});
+  cases.push_back({"sqrt", "sqrt", W, IW, true, 1, {0}, {100}, ref_sqrt, impl::sqrt_iter<W, IW, N_CORDIC>});
+  cases.push_back({"sqrt", "sqrt_nonrestoring", W, IW, true, 1, {0}, {100}, ref_sqrt, impl::sqrt_nonrestoring<W, IW, 0>});
+  cases.push_back({"rsqrt", "rsqrt", W, IW, true, 1, {0.01}, {100}, ref_rsqrt, impl::rsqrt<W, IW, N_NEWTON>});
+  cases.push_back({"reciprocal", "reciprocal", W, IW, false, 1, {-100}, {100}, ref_reciprocal, impl::reciprocal<W, IW, N_NEWTON>});
+  cases.push_back({"atan", "atan_rational", W, IW, false, 1, {-100}, {100}, ref_atan, impl::atan_rational<W, IW, 0>});
+  cases.push_back({"atan", "atan_cordic", W, IW, false, 1, {-100}, {100}, ref_atan, impl::atan_cordic<W, IW, N_CORDIC>});
+  cases.push_back({"asin", "asin_cordic", W, IW, false, 1, {-1}, {1}, ref_asin, impl::asin_cordic<W, IW, N_CORDIC>});
+  cases.push_back({"acos", "acos_cordic", W, IW, false, 1, {-1}, {1}, ref_acos, impl::acos_cordic<W, IW, N_CORDIC>});
+  cases.push_back({"sigmoid", "sigmoid", W, IW, false, 1, {-20}, {20}, ref_sigmoid, impl::sigmoid<W, IW, 0>});
+  cases.push_back({"tanh", "tanh", W, IW, false, 1, {-10}, {10}, ref_tanh, impl::tanh_poly<W, IW, 0>});
+  cases.push_back({"gelu", "gelu", W, IW, false, 1, {-10}, {10}, ref_gelu, impl::gelu<W, IW, 0>});
+  cases.push_back({"abs", "abs", W, IW, false, 1, {-100}, {100}, ref_abs, impl::abs<W, IW, 0>});
+  cases.push_back({"floor", "floor", W, IW, false, 1, {-100}, {100}, ref_floor, impl::floor<W, IW, 0>});
+  cases.push_back({"ceil", "ceil", W, IW, false, 1, {-100}, {100}, ref_ceil, impl::ceil<W, IW, 0>});
+  cases.push_back({"round", "round", W, IW, false, 1, {-100}, {100}, ref_round, impl::round<W, IW, 0>});
+  cases.push_back({"trunc", "trunc", W, IW, false, 1, {-100}, {100}, ref_trunc, impl::trunc<W, IW, 0>});
+  cases.push_back({"atan2", "atan2", W, IW, false, 2, {-10, -10}, {10, 10}, ref_atan2, impl::atan2<W, IW, N_CORDIC>});
+  cases.push_back({"hypot", "hypot", W, IW, false, 2, {-10, -10}, {10, 10}, ref_hypot, impl::hypot<W, IW, N_CORDIC>});
+  cases.push_back({"divide", "divide", W, IW, false, 2, {-10, -10}, {10, 10}, ref_divide, impl::divide<W, IW, N_NEWTON>});
+  cases.push_back({"pow", "pow", W, IW, false, 2, {0.1, -3}, {4, 3}, ref_pow, impl::pow<W, IW, 0>});
+  cases.push_back({"log", "log", W, IW, true, 2, {0.1, 1.5}, {100, 10}, ref_log, impl::log<W, IW, 0>});
+}
+
+// W/IW configurations to sweep, the same as the XS, S and M configurations
+// of the simple examples plus a 24 bit one.
+std::vector<Case> all_cases() {
+  std::vector<Case> cases;
+  add_config<16, 8>(cases);
+  add_config<24, 8>(cases);
+  add_config<32, 8>(cases);
+  add_config<32, 16>(cases);
+  return cases;
+}
+
+Result run_case(const Case &c, long max_points, int n_threads) {
+  // The range is clamped to what the input format can hold.
+  double lo[2], hi[2];
+  for (int i = 0; i < 2; i++) {
+    lo[i] = std::max(c.lo[i], format_min(c.W, c.IW, c.is_unsigned));
+    hi[i] = std::min(c.hi[i], format_max(c.W, c.IW, c.is_unsigned));
+  }
+  std::vector<double> a, b;
+  make_args(c.W, c.IW, c.arity, lo, hi, max_points, a, b);
+
+  long total = a.size();
+  std::vector<double> out(total);
+
+  // Only the implementation under test is timed; the reference is evaluated
+  // afterwards.
+  auto start = std::chrono::steady_clock::now();
+  parallel_for(total, n_threads, [&](int, long begin, long end) {
+    for (long i = begin; i < end; i++)
+      out[i] = c.dut(a[i], b[i]);
+  });
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  double ulp = std::ldexp(1.0, c.IW - (int)c.W);
+  std::vector<Result> partial(n_threads);
+  parallel_for(total, n_threads, [&](int t, long begin, long end) {
+    Result &r = partial[t];
+    for (long i = begin; i < end; i++) {
+      double expect = c.ref(a[i], b[i]);
+      // Results that the output format cannot hold are not counted.
+      if (!std::isfinite(expect) || !fits_output(expect, c.W, c.IW)) {
+        r.skipped++;
+        continue;
+      }
+      double e = std::fabs(out[i] - expect) / ulp;
+      if (e > r.max_ulp) {
+        r.max_ulp = e;
+        r.worst_a = a[i];
+        r.worst_b = b[i];
+      }
+      r.sum_ulp += e;
+      r.count++;
+    }
+  });
+
+  Result res;
+  for (const Result &r : partial) {
+    if (r.max_ulp > res.max_ulp || res.count == 0) {
+      res.max_ulp = r.max_ulp;
+      res.worst_a = r.worst_a;
+      res.worst_b = r.worst_b;
+    }
+    res.count += r.count;
+    res.skipped += r.skipped;
+    res.sum_ulp += r.sum_ulp;
+  }
+  res.seconds = elapsed.count();
+  return res;
+}
+
+void usage(const char *prog) {
+  printf("Usage: %s [options]\n"
+         "  --filter <str>      only run implementations whose name contains str\n"
+         "  --max-points <n>    max inputs per implementation and configuration (default 1048576)\n"
+         "  --threads <n>       number of threads (default: all cores)\n"
+         "  --json              print JSON instead of CSV\n"
+         "  --budget <ulp>      list the fastest implementation within a max ULP error\n"
+         "  --list              list the implementations and exit\n", prog);
+}
+
+int main(int argc, char **argv) {
+  const char *filter = "";
+  long max_points = 1 << 20;
+  int n_threads = std::thread::hardware_concurrency();
+  bool json = false, list = false;
+  double budget = -1;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--filter") && i + 1 < argc) filter = argv[++i];
+    else if (!strcmp(argv[i], "--max-points") && i + 1 < argc) max_points = atol(argv[++i]);
+    else if (!strcmp(argv[i], "--threads") && i + 1 < argc) n_threads = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--budget") && i + 1 < argc) budget = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--json")) json = true;
+    else if (!strcmp(argv[i], "--list")) list = true;
+    else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (n_threads < 1)
+    n_threads = 1;
+  if (max_points < 2)
+    max_points = 2;
+
+  std::vector<Case> cases = all_cases();
+  if (list) {
+    for (const Case &c : cases)
+      printf("%s,%s,%u,%d\n", c.function, c.impl, c.W, c.IW);
+    return 0;
+  }
+
+  // Fastest implementation within the budget for each function/configuration.
+  std::map<std::string, std::pair<const char *, double>> best;
+  bool first = true;
+
+  if (json) printf("[\n");
+  else printf("function,impl,W,IW,count,skipped,max_ulp,mean_ulp,worst_x,worst_y,evals_per_sec\n");
+
+  for (const Case &c : cases) {
+    if (!strstr(c.impl, filter))
+      continue;
+    Result r = run_case(c, max_points, n_threads);
+    double mean = r.count ? r.sum_ulp / r.count : 0;
+    double rate = r.seconds > 0 ? (r.count + r.skipped) / r.seconds : 0;
+
+    if (json) {
+      printf("%s  {\"function\": \"%s\", \"impl\": \"%s\", \"W\": %u, \"IW\": %d, \"count\": %ld, "
+             "\"skipped\": %ld, \"max_ulp\": %.4f, \"mean_ulp\": %.4f, \"worst_x\": %.10g, "
+             "\"worst_y\": %.10g, \"evals_per_sec\": %.0f}",
+             first ? "" : ",\n", c.function, c.impl, c.W, c.IW, r.count, r.skipped,
+             r.max_ulp, mean, r.worst_a, r.worst_b, rate);
+    } else {
+      printf("%s,%s,%u,%d,%ld,%ld,%.4f,%.4f,%.10g,%.10g,%.0f\n", c.function, c.impl, c.W, c.IW,
+             r.count, r.skipped, r.max_ulp, mean, r.worst_a, r.worst_b, rate);
+    }
+    fflush(stdout);
+    first = false;
+
+    if (budget >= 0 && r.count && r.max_ulp <= budget) {
+      std::string key = std::string(c.function) + " W=" + std::to_string(c.W) + " IW=" + std::to_string(c.IW);
+      auto it = best.find(key);
+      if (it == best.end() || rate > it->second.second)
+        best[key] = std::make_pair(c.impl, rate);
+    }
+  }
+  if (json) printf("\n]\n");
+
+  if (budget >= 0) {
+    fprintf(stderr, "Fastest implementation within %g ULP:\n", budget);
+    for (const auto &b : best)
+      fprintf(stderr, "  %-24s %s (%.0f evals/s)\n", b.first.c_str(), b.second.first, b.second.second);
+  }
+  return 0;
+}
@@ -3,22 +3,22 @@
 namespace hls{
 namespace math{
 const int LOG_TABLE_SIZE = 16;
-const hls::ap_ufixpt<20, 1> logTable[LOG_TABLE_SIZE] = {
+const hls::ap_ufixpt<32, 1> logTable[LOG_TABLE_SIZE] = {
 1,
-0.584963,
-0.321928,
-0.169925,
-0.0874628,
-0.0443941,
-0.0223678,
-0.0112273,
-0.00562455,
-0.00281502,
-0.00140819,
-0.000704269,
-0.000352177,
-0.000176099,
-8.80524e-05,
-4.40269e-05};
+0.5849625007,
+0.3219280949,
+0.1699250014,
+0.08746284125,
+0.04439411936,
+0.02236781303,
+0.01122725542,
+0.005624549194,
+0.002815015607,
+0.001408194393,
+0.0007042690112,
+0.0003521774803,
+0.0001760994864,
+8.805243012e-05,
+4.402688683e-05};
 
 }}
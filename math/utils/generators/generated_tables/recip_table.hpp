@@ -0,0 +1,137 @@
+#pragma once
+
+namespace hls{
+namespace math{
+const int RECIP_TABLE_BITS = 8;
+const int RECIP_TABLE_OFFSET = 128;
+const hls::ap_ufixpt<16, 2> recipTable[128] = {
+1.992217899,
+1.976833977,
+1.961685824,
+1.946768061,
+1.932075472,
+1.917602996,
+1.903345725,
+1.889298893,
+1.875457875,
+1.861818182,
+1.848375451,
+1.835125448,
+1.822064057,
+1.809187279,
+1.796491228,
+1.783972125,
+1.771626298,
+1.759450172,
+1.747440273,
+1.73559322,
+1.723905724,
+1.712374582,
+1.700996678,
+1.689768977,
+1.678688525,
+1.667752443,
+1.656957929,
+1.646302251,
+1.635782748,
+1.625396825,
+1.615141956,
+1.605015674,
+1.595015576,
+1.585139319,
+1.575384615,
+1.565749235,
+1.556231003,
+1.546827795,
+1.537537538,
+1.528358209,
+1.519287834,
+1.510324484,
+1.501466276,
+1.49271137,
+1.484057971,
+1.475504323,
+1.467048711,
+1.458689459,
+1.450424929,
+1.442253521,
+1.434173669,
+1.426183844,
+1.418282548,
+1.41046832,
+1.402739726,
+1.395095368,
+1.387533875,
+1.380053908,
+1.372654155,
+1.365333333,
+1.358090186,
+1.350923483,
+1.343832021,
+1.336814621,
+1.32987013,
+1.322997416,
+1.316195373,
+1.309462916,
+1.302798982,
+1.296202532,
+1.289672544,
+1.28320802,
+1.27680798,
+1.270471464,
+1.264197531,
+1.257985258,
+1.251833741,
+1.245742092,
+1.239709443,
+1.23373494,
+1.227817746,
+1.221957041,
+1.216152019,
+1.210401891,
+1.204705882,
+1.199063232,
+1.193473193,
+1.187935035,
+1.182448037,
+1.177011494,
+1.171624714,
+1.166287016,
+1.160997732,
+1.155756208,
+1.150561798,
+1.14541387,
+1.140311804,
+1.135254989,
+1.130242826,
+1.125274725,
+1.120350109,
+1.11546841,
+1.110629067,
+1.105831533,
+1.101075269,
+1.096359743,
+1.091684435,
+1.087048832,
+1.082452431,
+1.077894737,
+1.073375262,
+1.068893528,
+1.064449064,
+1.060041408,
+1.055670103,
+1.051334702,
+1.047034765,
+1.042769857,
+1.038539554,
+1.034343434,
+1.030181087,
+1.026052104,
+1.021956088,
+1.017892644,
+1.013861386,
+1.009861933,
+1.00589391,
+1.001956947};
+
+}}
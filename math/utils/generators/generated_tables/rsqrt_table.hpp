@@ -0,0 +1,201 @@
+#pragma once
+
+namespace hls{
+namespace math{
+const int RSQRT_TABLE_BITS = 8;
+const int RSQRT_TABLE_OFFSET = 64;
+const hls::ap_ufixpt<16, 2> rsqrtTable[192] = {
+1.99223298,
+1.976966602,
+1.962045886,
+1.947457982,
+1.933190699,
+1.91923246,
+1.905572269,
+1.892199667,
+1.879104702,
+1.866277899,
+1.853710228,
+1.84139308,
+1.829318242,
+1.81747787,
+1.805864474,
+1.794470893,
+1.78329028,
+1.772316082,
+1.761542024,
+1.750962097,
+1.740570538,
+1.730361825,
+1.720330658,
+1.710471948,
+1.700780811,
+1.691252552,
+1.68188266,
+1.672666795,
+1.663600784,
+1.654680608,
+1.6459024,
+1.637262432,
+1.628757115,
+1.620382987,
+1.61213671,
+1.604015063,
+1.596014938,
+1.588133334,
+1.580367355,
+1.572714199,
+1.565171162,
+1.557735627,
+1.550405066,
+1.543177031,
+1.536049154,
+1.529019144,
+1.522084781,
+1.515243916,
+1.508494467,
+1.501834414,
+1.495261803,
+1.488774737,
+1.482371375,
+1.476049933,
+1.469808679,
+1.463645932,
+1.45756006,
+1.451549477,
+1.445612645,
+1.439748066,
+1.433954288,
+1.428229897,
+1.422573518,
+1.416983817,
+1.411459492,
+1.405999281,
+1.400601951,
+1.395266305,
+1.389991177,
+1.384775432,
+1.379617963,
+1.374517695,
+1.369473576,
+1.364484585,
+1.359549724,
+1.354668021,
+1.34983853,
+1.345060325,
+1.340332507,
+1.335654194,
+1.331024529,
+1.326442676,
+1.321907816,
+1.317419151,
+1.312975904,
+1.308577312,
+1.304222634,
+1.299911142,
+1.295642128,
+1.2914149,
+1.287228779,
+1.283083104,
+1.278977227,
+1.274910517,
+1.270882353,
+1.266892132,
+1.262939261,
+1.259023161,
+1.255143265,
+1.251299019,
+1.247489881,
+1.243715319,
+1.239974813,
+1.236267855,
+1.232593945,
+1.228952596,
+1.22534333,
+1.221765677,
+1.21821918,
+1.214703389,
+1.211217863,
+1.20776217,
+1.204335887,
+1.2009386,
+1.197569902,
+1.194229393,
+1.190916684,
+1.18763139,
+1.184373136,
+1.181141553,
+1.177936278,
+1.174756957,
+1.171603242,
+1.168474789,
+1.165371265,
+1.16229234,
+1.15923769,
+1.156206998,
+1.153199952,
+1.150216248,
+1.147255583,
+1.144317664,
+1.1414022,
+1.138508907,
+1.135637506,
+1.132787721,
+1.129959282,
+1.127151926,
+1.12436539,
+1.12159942,
+1.118853762,
+1.11612817,
+1.113422401,
+1.110736215,
+1.108069378,
+1.105421657,
+1.102792827,
+1.100182663,
+1.097590945,
+1.095017457,
+1.092461987,
+1.089924325,
+1.087404266,
+1.084901606,
+1.082416146,
+1.079947691,
+1.077496048,
+1.075061025,
+1.072642437,
+1.070240099,
+1.067853831,
+1.065483453,
+1.063128791,
+1.060789671,
+1.058465923,
+1.056157379,
+1.053863875,
+1.051585248,
+1.049321337,
+1.047071986,
+1.044837038,
+1.04261634,
+1.040409742,
+1.038217095,
+1.036038253,
+1.033873072,
+1.031721408,
+1.029583123,
+1.027458079,
+1.025346138,
+1.023247167,
+1.021161034,
+1.019087608,
+1.017026762,
+1.014978368,
+1.012942301,
+1.010918438,
+1.008906658,
+1.006906841,
+1.004918869,
+1.002942625,
+1.000977995};
+
+}}
@@ -29,8 +29,8 @@ using std::to_string;
 // Change these parameters as needed:
 #define TABLE_SIZE 16
 // W_OUT & IW_OUT = configuration of table values. 
-#define W_OUT 16
-#define IW_OUT 2
+#define W_OUT 32
+#define IW_OUT 1
 
 int log_gentable(int size) {
     create_dir("generated_tables");
@@ -43,6 +43,7 @@ int log_gentable(int size) {
 	}
 
     std::ofstream ofs(filename, std::ofstream::out);
+    ofs.precision(10);
     ofs << "#pragma once" << endl << endl;
 
     ofs << "namespace hls{\nnamespace math{\nconst int LOG_TABLE_SIZE = " << TABLE_SIZE << ";\n";
@@ -0,0 +1,310 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+
+// Automatic precision selection for the math library.
+//
+// For one implementation (chosen at compile time with -DPRECISION_FUNC), an
+// input range and a max absolute error, every W/IW/N_ITERATIONS configuration
+// of a compile-time grid is evaluated with the bit-accurate software model,
+// spread across all cores. For each number of iterations the narrowest W that
+// meets the error target is reported, and the cheapest configuration overall
+// (smallest W, then fewest iterations) is written out as a header of #defines
+// that can be used directly as template arguments.
+
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../sweep.hpp"
+
+#ifndef PRECISION_FUNC
+#define PRECISION_FUNC sin_cordic
+#endif
+
+// Widths to sweep. Every W in [PRECISION_W_MIN, PRECISION_W_MAX] in steps of
+// PRECISION_W_STEP is combined with every IW in [1, PRECISION_IW_MAX].
+#ifndef PRECISION_W_MIN
+#define PRECISION_W_MIN 8
+#endif
+#ifndef PRECISION_W_MAX
+#define PRECISION_W_MAX 32
+#endif
+#ifndef PRECISION_W_STEP
+#define PRECISION_W_STEP 2
+#endif
+#ifndef PRECISION_IW_MAX
+#define PRECISION_IW_MAX 10
+#endif
+
+/* Implementations that can be tuned.
+ *
+ * Each one is a struct with the software model and the reference from
+ * ../sweep.hpp, which the benchmark shares, and the range of N_ITERATIONS to
+ * sweep (N_FIRST = N_LAST = 0 when the implementation has no such
+ * parameter). Only the one selected by PRECISION_FUNC is instantiated, so
+ * adding more does not slow down the build. */
+#define PRECISION_TUNE(NAME, ARITY_, UNSIGNED, N_MIN, N_MAX, N_STEP, REF)  \
+  struct NAME {                                                          \
+    static const int ARITY = ARITY_;                                     \
+    static const bool IS_UNSIGNED = UNSIGNED;                            \
+    static const int N_FIRST = N_MIN, N_LAST = N_MAX, N_INC = N_STEP;    \
+    static const char *name() { return #NAME; }                          \
+    static double ref(double a, double b) { return REF(a, b); }          \
+    template <unsigned int W, int IW, int N>                             \
+    static double eval(double a, double b) {                             \
+      return impl::NAME<W, IW, N>(a, b);                                 \
+    }                                                                    \
+  };
+
+namespace tune {
+
+// CORDIC iterations are swept in [6, 16]; the angle tables hold 16 entries.
+// Newton-Raphson iterations after the table seed are swept in [0, 3].
+PRECISION_TUNE(sin_lut, 1, false, 0, 0, 1, ref_sin)
+PRECISION_TUNE(sin_cordic, 1, false, 6, 16, 2, ref_sin)
+PRECISION_TUNE(sin_taylor, 1, false, 0, 0, 1, ref_sin)
+PRECISION_TUNE(cos_lut, 1, false, 0, 0, 1, ref_cos)
+PRECISION_TUNE(cos_cordic, 1, false, 6, 16, 2, ref_cos)
+PRECISION_TUNE(cos_taylor, 1, false, 0, 0, 1, ref_cos)
+PRECISION_TUNE(tan_lut, 1, false, 0, 0, 1, ref_tan)
+PRECISION_TUNE(tan_cordic, 1, false, 6, 16, 2, ref_tan)
+PRECISION_TUNE(exp_taylor, 1, false, 0, 0, 1, ref_exp)
+PRECISION_TUNE(exp_cordic, 1, false, 6, 16, 2, ref_exp)
+PRECISION_TUNE(exp_lut, 1, false, 0, 0, 1, ref_exp)
+PRECISION_TUNE(ln_lut, 1, true, 0, 0, 1, ref_ln)
+PRECISION_TUNE(ln_cordic, 1, true, 6, 16, 2, ref_ln)
+PRECISION_TUNE(log2_lut, 1, true, 0, 0, 1, ref_log2)
+PRECISION_TUNE(log2_cordic, 1, true, 6, 16, 2, ref_log2)
+PRECISION_TUNE(sqrt_iter, 1, true, 6, 16, 2, ref_sqrt)
+PRECISION_TUNE(sqrt_nonrestoring, 1, true, 0, 0, 1, ref_sqrt)
+PRECISION_TUNE(rsqrt, 1, true, 0, 3, 1, ref_rsqrt)
+PRECISION_TUNE(reciprocal, 1, false, 0, 3, 1, ref_reciprocal)
+PRECISION_TUNE(atan_rational, 1, false, 0, 0, 1, ref_atan)
+PRECISION_TUNE(atan_cordic, 1, false, 6, 16, 2, ref_atan)
+PRECISION_TUNE(asin_cordic, 1, false, 6, 16, 2, ref_asin)
+PRECISION_TUNE(acos_cordic, 1, false, 6, 16, 2, ref_acos)
+PRECISION_TUNE(sigmoid, 1, false, 0, 0, 1, ref_sigmoid)
+PRECISION_TUNE(tanh_poly, 1, false, 0, 0, 1, ref_tanh)
+PRECISION_TUNE(gelu, 1, false, 0, 0, 1, ref_gelu)
+PRECISION_TUNE(atan2, 2, false, 6, 16, 2, ref_atan2)
+PRECISION_TUNE(hypot, 2, false, 6, 16, 2, ref_hypot)
+PRECISION_TUNE(divide, 2, false, 0, 3, 1, ref_divide)
+PRECISION_TUNE(pow, 2, false, 0, 0, 1, ref_pow)
+
+} // namespace tune
+
+typedef tune::PRECISION_FUNC Func;
+
+struct Config {
+  unsigned int W;
+  int IW, N;
+  dut_fn dut;
+};
+
+// Compile-time loops over the grid. Each level is a struct so that the
+// recursion ends with a partial specialization (no if constexpr needed).
+template <unsigned int W, int IW, int N, bool DONE = (N > Func::N_LAST)>
+struct sweep_n {
+  static void add(std::vector<Config> &v) {
+    v.push_back({W, IW, N, Func::template eval<W, IW, N>});
+    sweep_n<W, IW, N + Func::N_INC>::add(v);
+  }
+};
+template <unsigned int W, int IW, int N> struct sweep_n<W, IW, N, true> {
+  static void add(std::vector<Config> &) {}
+};
+
+template <unsigned int W, int IW, bool DONE = (IW > PRECISION_IW_MAX || IW >= (int)W)>
+struct sweep_iw {
+  static void add(std::vector<Config> &v) {
+    sweep_n<W, IW, Func::N_FIRST>::add(v);
+    sweep_iw<W, IW + 1>::add(v);
+  }
+};
+template <unsigned int W, int IW> struct sweep_iw<W, IW, true> {
+  static void add(std::vector<Config> &) {}
+};
+
+template <unsigned int W, bool DONE = (W > PRECISION_W_MAX)> struct sweep_w {
+  static void add(std::vector<Config> &v) {
+    sweep_iw<W, 1>::add(v);
+    sweep_w<W + PRECISION_W_STEP>::add(v);
+  }
+};
+template <unsigned int W> struct sweep_w<W, true> {
+  static void add(std::vector<Config> &) {}
+};
+
+struct Range {
+  double lo[2], hi[2];
+};
+
+// Max absolute error of c over the range, or -1 if the range or a result
+// does not fit the format.
+double max_error(const Config &c, const Range &r, long max_points, int n_threads) {
+  for (int i = 0; i < Func::ARITY; i++) {
+    if (r.lo[i] < format_min(c.W, c.IW, Func::IS_UNSIGNED) ||
+        r.hi[i] > format_max(c.W, c.IW, Func::IS_UNSIGNED))
+      return -1;
+  }
+
+  std::vector<double> a, b;
+  make_args(c.W, c.IW, Func::ARITY, r.lo, r.hi, max_points, a, b);
+
+  std::vector<double> worst(n_threads, 0);
+  parallel_for(a.size(), n_threads, [&](int t, long begin, long end) {
+    for (long i = begin; i < end; i++) {
+      double expect = Func::ref(a[i], b[i]);
+      // Poles such as ln(0) are not counted.
+      if (!std::isfinite(expect))
+        continue;
+      if (!fits_output(expect, c.W, c.IW)) {
+        worst[t] = -1;
+        return;
+      }
+      double e = std::fabs(c.dut(a[i], b[i]) - expect);
+      if (e > worst[t])
+        worst[t] = e;
+    }
+  });
+
+  double m = 0;
+  for (double w : worst) {
+    if (w < 0)
+      return -1;
+    m = std::max(m, w);
+  }
+  return m;
+}
+
+void write_header(const char *path, const std::string &prefix, const Config &c, double err,
+                  const Range &r, double target) {
+  FILE *f = fopen(path, "w");
+  if (!f) {
+    fprintf(stderr, "Cannot open %s\n", path);
+    exit(1);
+  }
+  fprintf(f, "// Generated by math/utils/precision for %s.\n", Func::name());
+  fprintf(f, "// Input range: [%g, %g]", r.lo[0], r.hi[0]);
+  if (Func::ARITY == 2)
+    fprintf(f, " x [%g, %g]", r.lo[1], r.hi[1]);
+  fprintf(f, ", max absolute error: %g (measured: %g).\n", target, err);
+  fprintf(f, "#pragma once\n\n");
+  fprintf(f, "#define %s_W %u  // Width\n", prefix.c_str(), c.W);
+  fprintf(f, "#define %s_IW %d  // Width of the integer part\n", prefix.c_str(), c.IW);
+  if (Func::N_LAST > 0)
+    fprintf(f, "#define %s_N_ITER %d  // Number of iterations\n", prefix.c_str(), c.N);
+  fclose(f);
+}
+
+void usage(const char *prog) {
+  printf("Usage: %s --range <lo> <hi> --max-error <e> [options]\n"
+         "  --range <lo> <hi>   input range (first argument)\n"
+         "  --range2 <lo> <hi>  input range of the second argument (binary functions)\n"
+         "  --max-error <e>     max absolute error\n"
+         "  --max-points <n>    max inputs per configuration (default 65536)\n"
+         "  --threads <n>       number of threads (default: all cores)\n"
+         "  --out <file>        header to write (default <function>_precision.hpp)\n"
+         "  --prefix <str>      prefix of the macros (default: function name in upper case)\n"
+         "Tuning: %s\n", prog, Func::name());
+}
+
+int main(int argc, char **argv) {
+  Range range = {{0, 0}, {0, 0}};
+  bool has_range = false, has_range2 = false;
+  double target = -1;
+  long max_points = 1 << 16;
+  int n_threads = std::thread::hardware_concurrency();
+  std::string out = std::string(Func::name()) + "_precision.hpp";
+  std::string prefix;
+  for (const char *p = Func::name(); *p; p++)
+    prefix += (char)toupper(*p);
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--range") && i + 2 < argc) {
+      range.lo[0] = atof(argv[++i]);
+      range.hi[0] = atof(argv[++i]);
+      has_range = true;
+    } else if (!strcmp(argv[i], "--range2") && i + 2 < argc) {
+      range.lo[1] = atof(argv[++i]);
+      range.hi[1] = atof(argv[++i]);
+      has_range2 = true;
+    } else if (!strcmp(argv[i], "--max-error") && i + 1 < argc) target = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--max-points") && i + 1 < argc) max_points = atol(argv[++i]);
+    else if (!strcmp(argv[i], "--threads") && i + 1 < argc) n_threads = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--out") && i + 1 < argc) out = argv[++i];
+    else if (!strcmp(argv[i], "--prefix") && i + 1 < argc) prefix = argv[++i];
+    else {
+      usage(argv[0]);
+      return 1;
+    }
+  }
+  if (!has_range || target <= 0 || (Func::ARITY == 2 && !has_range2) || range.hi[0] < range.lo[0] ||
+      range.hi[1] < range.lo[1]) {
+    usage(argv[0]);
+    return 1;
+  }
+  if (n_threads < 1)
+    n_threads = 1;
+  if (max_points < 2)
+    max_points = 2;
+
+  std::vector<Config> configs;
+  sweep_w<PRECISION_W_MIN>::add(configs);
+
+  // For each number of iterations, the narrowest W that meets the target.
+  // Configurations are in increasing W, then IW, so the first one that passes
+  // is the narrowest, and the one with the fewest integer bits for that W.
+  printf("function,N_ITER,W,IW,max_error\n");
+  const Config *best = nullptr;
+  double best_err = 0;
+  for (int n = Func::N_FIRST; n <= Func::N_LAST; n += Func::N_INC) {
+    for (const Config &c : configs) {
+      if (c.N != n)
+        continue;
+      double err = max_error(c, range, max_points, n_threads);
+      if (err < 0 || err > target)
+        continue;
+      printf("%s,%d,%u,%d,%.6g\n", Func::name(), c.N, c.W, c.IW, err);
+      fflush(stdout);
+      if (!best || c.W < best->W) {
+        best = &c;
+        best_err = err;
+      }
+      break;
+    }
+  }
+
+  if (!best) {
+    fprintf(stderr, "No configuration of %s with W <= %d meets a max error of %g.\n", Func::name(),
+            PRECISION_W_MAX, target);
+    return 1;
+  }
+  write_header(out.c_str(), prefix, *best, best_err, range, target);
+  fprintf(stderr, "Cheapest: W=%u IW=%d", best->W, best->IW);
+  if (Func::N_LAST > 0)
+    fprintf(stderr, " N_ITER=%d", best->N);
+  fprintf(stderr, ", written to %s\n", out.c_str());
+  return 0;
+}
@@ -0,0 +1,235 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING
+// ANY IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR
+// A PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY
+// INDIRECT, SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST
+// OR EXPENSE OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED,
+// EVEN IF MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE
+// FORESEEABLE.  TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL
+// LIABILITY ON ALL CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF
+// FEES, IF ANY, YOU PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP
+// OFFERS NO SUPPORT FOR THE SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+// Shared by the benchmark and the precision tools: the software models of the
+// implementations, their references, the input sampling and the threaded
+// sweep over the inputs.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "hls_math.hpp"
+#include "hls_sincos.hpp"
+
+/* Implementations.
+ *
+ * The wrappers only convert between double and fixed point, so that all
+ * implementations can be handled in the same way. The input and output
+ * formats are both ap_[u]fixpt<W, IW>. N is the number of CORDIC or
+ * Newton-Raphson iterations, and is ignored by the implementations that
+ * have no such parameter. They live in their own namespace so that names
+ * such as atan2 do not clash with <cmath>. */
+typedef double (*dut_fn)(double, double);
+
+#define SWEEP_UNARY(NAME, TYPE, ...)             \
+  template <unsigned int W, int IW, int N>       \
+  double NAME(double a, double) {                \
+    TYPE<W, IW> x = a;                           \
+    return (double)(__VA_ARGS__);                \
+  }
+
+#define SWEEP_BINARY(NAME, TYPE, ...)            \
+  template <unsigned int W, int IW, int N>       \
+  double NAME(double a, double b) {              \
+    TYPE<W, IW> x = a;                           \
+    TYPE<W, IW> y = b;                           \
+    return (double)(__VA_ARGS__);                \
+  }
+
+namespace impl {
+
+using namespace hls;
+
+SWEEP_UNARY(sin_lut, ap_fixpt, math::sin_lut<W, IW>(x))
+SWEEP_UNARY(sin_cordic, ap_fixpt, math::sin_cordic<W, IW, N>(x))
+SWEEP_UNARY(sin_taylor, ap_fixpt, math::sin_taylor<W, IW>(x))
+SWEEP_UNARY(cos_lut, ap_fixpt, math::cos_lut<W, IW>(x))
+SWEEP_UNARY(cos_cordic, ap_fixpt, math::cos_cordic<W, IW, N>(x))
+SWEEP_UNARY(cos_taylor, ap_fixpt, math::cos_taylor<W, IW>(x))
+SWEEP_UNARY(tan_lut, ap_fixpt, math::tan_lut<W, IW>(x))
+SWEEP_UNARY(tan_cordic, ap_fixpt, math::tan_cordic<W, IW, N>(x))
+SWEEP_UNARY(tan_taylor, ap_fixpt, math::tan_taylor<W, IW>(x))
+SWEEP_UNARY(exp_taylor, ap_fixpt, math::exp_taylor<W, IW>(x))
+SWEEP_UNARY(exp_cordic, ap_fixpt, math::exp_cordic<W, IW, N>(x))
+SWEEP_UNARY(exp_lut, ap_fixpt, math::exp_lut<W, IW>(x))
+SWEEP_UNARY(ln_lut, ap_ufixpt, math::ln_lut<W, IW>(x))
+SWEEP_UNARY(ln_cordic, ap_ufixpt, math::ln_cordic<W, IW, N>(x))
+SWEEP_UNARY(log2_lut, ap_ufixpt, math::log2_lut<W, IW>(x))
+SWEEP_UNARY(log2_cordic, ap_ufixpt, math::log2_cordic<W, IW, N>(x))
+SWEEP_UNARY(sqrt_iter, ap_ufixpt, math::sqrt<W, IW, N>(x))
+SWEEP_UNARY(sqrt_nonrestoring, ap_ufixpt, math::sqrt_nonrestoring<W, IW>(x))
+SWEEP_UNARY(rsqrt, ap_ufixpt, math::rsqrt<W, IW, N>(x))
+SWEEP_UNARY(reciprocal, ap_fixpt, math::reciprocal<W, IW, N>(x))
+SWEEP_UNARY(atan_rational, ap_fixpt, math::atan_rational<W, IW>(x))
+SWEEP_UNARY(atan_cordic, ap_fixpt, math::atan_cordic<W, IW, N>(x))
+SWEEP_UNARY(asin_cordic, ap_fixpt, math::asin_cordic<W, IW, N>(x))
+SWEEP_UNARY(acos_cordic, ap_fixpt, math::acos_cordic<W, IW, N>(x))
+SWEEP_UNARY(sigmoid, ap_fixpt, math::sigmoid<W, IW>(x))
+SWEEP_UNARY(tanh_poly, ap_fixpt, math::tanh<W, IW>(x))
+SWEEP_UNARY(gelu, ap_fixpt, math::gelu<W, IW>(x))
+SWEEP_UNARY(abs, ap_fixpt, math::abs<W, IW>(x))
+SWEEP_UNARY(floor, ap_fixpt, math::floor<W, IW>(x))
+SWEEP_UNARY(ceil, ap_fixpt, math::ceil<W, IW>(x))
+SWEEP_UNARY(round, ap_fixpt, math::round<W, IW>(x))
+SWEEP_UNARY(trunc, ap_fixpt, math::trunc<W, IW>(x))
+SWEEP_BINARY(atan2, ap_fixpt, math::atan2<W, IW, N>(x, y))
+SWEEP_BINARY(hypot, ap_fixpt, math::hypot<W, IW, N>(x, y))
+SWEEP_BINARY(divide, ap_fixpt, math::divide<W, IW, N>(x, y))
+SWEEP_BINARY(pow, ap_fixpt, math::pow<W, IW>(x, y))
+SWEEP_BINARY(log, ap_ufixpt, math::log<W, IW>(x, y))
+
+template <unsigned int W, int IW, int N>
+double sincos_sin(double a, double) {
+  ap_fixpt<W, IW> x = a, s, c;
+  math::sincos<N>(x, s, c);
+  return (double)s;
+}
+
+template <unsigned int W, int IW, int N>
+double sincos_cos(double a, double) {
+  ap_fixpt<W, IW> x = a, s, c;
+  math::sincos<N>(x, s, c);
+  return (double)c;
+}
+
+template <unsigned int W, int IW, int N>
+double sincos_lut_sin(double a, double) {
+  ap_fixpt<W, IW> x = a, s, c;
+  math::sincos_lut(x, s, c);
+  return (double)s;
+}
+
+template <unsigned int W, int IW, int N>
+double sincos_lut_cos(double a, double) {
+  ap_fixpt<W, IW> x = a, s, c;
+  math::sincos_lut(x, s, c);
+  return (double)c;
+}
+
+} // namespace impl
+
+/* Reference implementations. */
+inline double ref_sin(double a, double) { return std::sin(a); }
+inline double ref_cos(double a, double) { return std::cos(a); }
+inline double ref_tan(double a, double) { return std::tan(a); }
+inline double ref_exp(double a, double) { return std::exp(a); }
+inline double ref_ln(double a, double) { return std::log(a); }
+inline double ref_log2(double a, double) { return std::log2(a); }
+inline double ref_sqrt(double a, double) { return std::sqrt(a); }
+inline double ref_rsqrt(double a, double) { return 1 / std::sqrt(a); }
+inline double ref_reciprocal(double a, double) { return 1 / a; }
+inline double ref_atan(double a, double) { return std::atan(a); }
+inline double ref_asin(double a, double) { return std::asin(a); }
+inline double ref_acos(double a, double) { return std::acos(a); }
+inline double ref_sigmoid(double a, double) { return 1 / (1 + std::exp(-a)); }
+inline double ref_tanh(double a, double) { return std::tanh(a); }
+inline double ref_gelu(double a, double) { return 0.5 * a * (1 + std::erf(a / std::sqrt(2.0))); }
+inline double ref_abs(double a, double) { return std::fabs(a); }
+inline double ref_floor(double a, double) { return std::floor(a); }
+inline double ref_ceil(double a, double) { return std::ceil(a); }
+inline double ref_round(double a, double) { return std::floor(a + 0.5); }
+inline double ref_trunc(double a, double) { return std::trunc(a); }
+inline double ref_atan2(double a, double b) { return std::atan2(a, b); }
+inline double ref_hypot(double a, double b) { return std::hypot(a, b); }
+inline double ref_divide(double a, double b) { return a / b; }
+inline double ref_pow(double a, double b) { return std::pow(a, b); }
+inline double ref_log(double a, double b) { return std::log(a) / std::log(b); }
+
+/* Formats. */
+
+// Range of the input format ap_[u]fixpt<W, IW>.
+inline double format_min(unsigned int W, int IW, bool is_unsigned) {
+  return is_unsigned ? 0 : -std::ldexp(1.0, IW - 1);
+}
+inline double format_max(unsigned int W, int IW, bool is_unsigned) {
+  double ulp = std::ldexp(1.0, IW - (int)W);
+  return (is_unsigned ? std::ldexp(1.0, IW) : std::ldexp(1.0, IW - 1)) - ulp;
+}
+
+// Whether a result fits the output format. Some outputs are signed even for
+// unsigned inputs (e.g. ln), so the signed range is used.
+inline bool fits_output(double y, unsigned int W, int IW) {
+  double ulp = std::ldexp(1.0, IW - (int)W);
+  return y >= -std::ldexp(1.0, IW - 1) && y <= std::ldexp(1.0, IW - 1) - ulp;
+}
+
+/* Input sampling. */
+
+// Inputs of one argument in the format ap_[u]fixpt<W, IW>: every
+// representable value in [lo, hi] if there are at most n of them, otherwise
+// n evenly spaced samples.
+inline std::vector<double> make_inputs(unsigned int W, int IW, double lo, double hi, long n) {
+  double ulp = std::ldexp(1.0, IW - (int)W);
+  long first = (long)std::ceil(lo / ulp), last = (long)std::floor(hi / ulp);
+
+  std::vector<double> in;
+  if (last < first)
+    return in;
+  if (last - first + 1 <= n) {
+    for (long k = first; k <= last; k++)
+      in.push_back(k * ulp);
+  } else {
+    for (long i = 0; i < n; i++)
+      in.push_back(std::floor((lo + (hi - lo) * i / (n - 1)) / ulp) * ulp);
+  }
+  return in;
+}
+
+// Inputs of a one- or two-argument function, at most max_points of them. The
+// inputs of a two-argument function are a grid of sqrt(max_points) samples
+// of each argument; b is all 0 for a one-argument function.
+inline void make_args(unsigned int W, int IW, int arity, const double lo[2], const double hi[2],
+                      long max_points, std::vector<double> &a, std::vector<double> &b) {
+  a.clear();
+  b.clear();
+  if (arity == 1) {
+    a = make_inputs(W, IW, lo[0], hi[0], max_points);
+    b.assign(a.size(), 0);
+  } else {
+    long n = (long)std::sqrt((double)max_points);
+    std::vector<double> a1 = make_inputs(W, IW, lo[0], hi[0], n);
+    std::vector<double> b1 = make_inputs(W, IW, lo[1], hi[1], n);
+    for (double x : a1)
+      for (double y : b1) {
+        a.push_back(x);
+        b.push_back(y);
+      }
+  }
+}
+
+/* Threaded sweep. */
+
+// Splits [0, total) into one contiguous chunk per thread and calls
+// body(t, begin, end) for chunk t on its own thread.
+template <typename F>
+void parallel_for(long total, int n_threads, F body) {
+  long chunk = (total + n_threads - 1) / n_threads;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < n_threads; t++) {
+    long begin = std::min(total, t * chunk), end = std::min(total, (t + 1) * chunk);
+    threads.emplace_back([&body, t, begin, end]() { body(t, begin, end); });
+  }
+  for (auto &th : threads)
+    th.join();
+}
@@ -0,0 +1,199 @@
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include "vision.hpp"
+#include <opencv2/opencv.hpp>
+
+using namespace hls;
+using namespace hls::vision;
+
+
+//=====================================================================
+//  Macros
+//=====================================================================
+#define WIDTH               320
+#define HEIGHT              240
+#define PIXEL_TYPE          PixelType::HLS_8UC1
+#define TILES_X             8
+#define TILES_Y             8
+#define CLIP_LIMIT          2.0f
+// Use FRAME_BUFFER for data comming from memory over AXI.  Otherwise use FIFO
+// but also change the pragma interface to type(simple).
+#define STORAGE_TYPE        StorageType::FIFO
+// #define STORAGE_TYPE     StorageType::FRAME_BUFFER
+
+using ImageT = Img<PIXEL_TYPE, HEIGHT, WIDTH, STORAGE_TYPE, NPPC_1>;
+
+// OpenCV computes the LUTs and the interpolation in float, so it can round a
+// value within about this much of a .5 tie either way.
+#define TIE_EPS             1e-4
+
+
+//=====================================================================
+//  HLS CLAHE Function Definition
+//=====================================================================
+void claheWrapper(ImageT &InImg, ImageT &OutImg) {
+    #pragma HLS function top
+    #pragma HLS interface argument(InImg) type(simple)
+    #pragma HLS interface argument(OutImg) type(simple)
+
+    hls::vision::CLAHE<TILES_X, TILES_Y>(InImg, OutImg, CLIP_LIMIT);
+}
+
+//=====================================================================
+//  Exact software reference
+//=====================================================================
+// Same algorithm as cv::CLAHE, with exact rational arithmetic and ties
+// rounded up. Ties[p] is set for the pixels whose value, or one of the LUT
+// values it is interpolated from, is within TIE_EPS of a tie, so OpenCV may
+// round it either way.
+static bool isTie(long long Num, long long Den) {
+    double Frac = (double)(Num % Den) / Den;
+    return std::fabs(Frac - 0.5) < TIE_EPS;
+}
+
+void claheReference(const cv::Mat &InMat, cv::Mat &RefMat,
+                    std::vector<bool> &Ties) {
+    const int TW = WIDTH / TILES_X, TH = HEIGHT / TILES_Y, Area = TW * TH;
+    const int Clip = std::max(1, (int)(CLIP_LIMIT * Area / 256));
+    std::vector<int> Lut(TILES_X * TILES_Y * 256);
+    std::vector<bool> LutTie(Lut.size());
+    for (int t = 0; t < TILES_X * TILES_Y; t++) {
+        int ty = t / TILES_X, tx = t % TILES_X;
+        int Hist[256] = {0};
+        for (int y = 0; y < TH; y++)
+            for (int x = 0; x < TW; x++)
+                Hist[InMat.at<uchar>(ty * TH + y, tx * TW + x)]++;
+        int Excess = 0;
+        for (int i = 0; i < 256; i++) {
+            if (Hist[i] > Clip) {
+                Excess += Hist[i] - Clip;
+                Hist[i] = Clip;
+            }
+        }
+        int Batch = Excess / 256, Residual = Excess % 256;
+        for (int i = 0; i < 256; i++)
+            Hist[i] += Batch;
+        if (Residual) {
+            int Step = std::max(256 / Residual, 1);
+            for (int i = 0; i < 256 && Residual > 0; i += Step, Residual--)
+                Hist[i]++;
+        }
+        long long Cdf = 0;
+        for (int i = 0; i < 256; i++) {
+            Cdf += Hist[i];
+            Lut[t * 256 + i] = (Cdf * 255 + Area / 2) / Area;
+            LutTie[t * 256 + i] = isTie(Cdf * 255, Area);
+        }
+    }
+
+    // The weights of tiles (ty1, tx1 + 1) and (ty1 + 1, tx1) are nx / (2 * TW)
+    // and ny / (2 * TH).
+    const long long Den = 4LL * TW * TH;
+    RefMat = cv::Mat(HEIGHT, WIDTH, CV_8UC1, cv::Scalar(0));
+    Ties.assign(HEIGHT * WIDTH, false);
+    for (int y = 0; y < HEIGHT; y++) {
+        int ty1 = (2 * y - TH) >= 0 ? (2 * y - TH) / (2 * TH) : -1;
+        int ny = 2 * y - TH - 2 * TH * ty1;
+        if (ty1 < 0)           { ty1 = 0;           ny = 0; }
+        if (ty1 > TILES_Y - 2) { ty1 = TILES_Y - 2; ny = 2 * TH; }
+        for (int x = 0; x < WIDTH; x++) {
+            int tx1 = (2 * x - TW) >= 0 ? (2 * x - TW) / (2 * TW) : -1;
+            int nx = 2 * x - TW - 2 * TW * tx1;
+            if (tx1 < 0)           { tx1 = 0;           nx = 0; }
+            if (tx1 > TILES_X - 2) { tx1 = TILES_X - 2; nx = 2 * TW; }
+            int v = InMat.at<uchar>(y, x);
+            long long Num = 0;
+            bool Tie = false;
+            for (int dy = 0; dy < 2; dy++) {
+                for (int dx = 0; dx < 2; dx++) {
+                    long long Weight = (dx ? nx : 2 * TW - nx) *
+                                       (long long)(dy ? ny : 2 * TH - ny);
+                    int Idx = ((ty1 + dy) * TILES_X + tx1 + dx) * 256 + v;
+                    Num += Lut[Idx] * Weight;
+                    Tie |= Weight && LutTie[Idx];
+                }
+            }
+            RefMat.at<uchar>(y, x) = (Num + Den / 2) / Den;
+            Ties[y * WIDTH + x] = Tie || isTie(Num, Den);
+        }
+    }
+}
+
+//====================================================================
+//  Software Testbench
+//====================================================================
+int main(int argc, char* argv[]) {
+
+    if(argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " <input_file.png>" << std::endl;
+        return -1;
+    }
+    std::string INPUT_IMAGE=argv[1];
+
+    cv::Mat InMat = cv::imread(INPUT_IMAGE, cv::IMREAD_GRAYSCALE);
+    if (InMat.empty()) {
+        std::cerr << "Unable to open input file" << std::endl;
+        return -1;
+    }
+
+    //
+    // With HLS
+    //
+    // The first frame only primes the tile LUTs; send the same frame again
+    // so the second output uses the LUTs of its own tiles.
+    ImageT InImg, InImg2, OutImg;
+    cv::Mat hlsMat(HEIGHT, WIDTH, CV_8UC1, cv::Scalar(0));
+    convertFromCvMat(InMat, InImg);
+    convertFromCvMat(InMat, InImg2);
+    claheWrapper(InImg, OutImg);
+    convertToCvMat(OutImg, hlsMat);
+    claheWrapper(InImg2, OutImg);
+    convertToCvMat(OutImg, hlsMat);
+    cv::imwrite("hls_output.png", hlsMat);
+
+    //
+    // With OpenCV
+    //
+    cv::Mat cvMat;
+    cv::Ptr<cv::CLAHE> clahe = cv::createCLAHE(CLIP_LIMIT, cv::Size(TILES_X, TILES_Y));
+    clahe->apply(InMat, cvMat);
+    cv::imwrite("opencv_output.png", cvMat);
+
+    //
+    // With the exact reference
+    //
+    cv::Mat refMat;
+    std::vector<bool> Ties;
+    claheReference(InMat, refMat, Ties);
+
+    //
+    // check the errors
+    //
+    // The HLS version must match the exact reference everywhere. It may only
+    // differ from OpenCV, by 1, where OpenCV rounds a tie the other way.
+    float ErrPercent = compareMat(hlsMat, refMat, 0);
+    std::cout << "Percentage of over threshold for reference image :" << ErrPercent  << "%" << std::endl;
+    int TieDiffs = 0, OtherDiffs = 0;
+    for (int y = 0; y < HEIGHT; y++) {
+        for (int x = 0; x < WIDTH; x++) {
+            int Diff = std::abs(hlsMat.at<uchar>(y, x) - cvMat.at<uchar>(y, x));
+            if (Diff == 0)
+                continue;
+            if (Diff == 1 && Ties[y * WIDTH + x])
+                TieDiffs++;
+            else
+                OtherDiffs++;
+        }
+    }
+    std::cout << "Pixels different from opencv image: " << TieDiffs
+              << " at ties, " << OtherDiffs << " elsewhere" << std::endl;
+    int error = (ErrPercent != 0.0) || (OtherDiffs != 0);
+    if(error) {
+        std::cout << "FAIL\n";
+    } else {
+        std::cout << "PASS\n";
+    }
+
+    return error;
+}
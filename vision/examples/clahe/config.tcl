@@ -0,0 +1,4 @@
+source $env(SHLS_ROOT_DIR)/examples/legup.tcl
+set_project PolarFire MPF300 hw_only
+
+set_parameter CLOCK_PERIOD 20
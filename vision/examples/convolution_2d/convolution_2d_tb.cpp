@@ -0,0 +1,183 @@
+#include "vision.hpp"
+#include <opencv2/opencv.hpp>
+
+using namespace hls;
+using cv::Mat;
+using vision::Img;
+
+#ifdef SMALL_TEST_FRAME
+#define WIDTH 100
+#define HEIGHT 56
+#else
+#define WIDTH 1920
+#define HEIGHT 1080
+#endif
+#define SIZE (WIDTH * HEIGHT)
+
+using ImgT1 = Img<vision::PixelType::HLS_8UC1, HEIGHT, WIDTH,
+                  vision::StorageType::FIFO, vision::NPPC_2>;
+using ImgT3 = Img<vision::PixelType::HLS_8UC3, HEIGHT, WIDTH,
+                  vision::StorageType::FIFO, vision::NPPC_1>;
+using ImgT3N2 = Img<vision::PixelType::HLS_8UC3, HEIGHT, WIDTH,
+                    vision::StorageType::FIFO, vision::NPPC_2>;
+
+// The kernels are in units of 1/256. They are not symmetric, so a kernel that
+// is flipped or transposed by mistake is caught.
+int Coeffs2D[5][5] = {
+    {1, 2,  4,  2,  0},
+    {2, 8,  16, 8,  1},
+    {4, 16, 72, 32, -8},
+    {2, 8,  32, 16, 2},
+    {0, 1,  8,  4,  2},
+};
+
+constexpr int SepKernelX(int i) {
+    return (i == 0) ? 1 : (i == 1) ? 3 : (i == 2) ? 6 : (i == 3) ? 4 : 2;
+}
+constexpr int SepKernelY(int i) {
+    return (i == 0) ? 2 : (i == 1) ? 4 : (i == 2) ? 6 : (i == 3) ? 3 : 1;
+}
+
+int CoeffsX[3] = {3, 8, 5};
+int CoeffsY[3] = {4, 10, 2};
+
+// BORDER_CONSTANT padding of the 8UC3 image, channel 0 in the low byte.
+#define BORDER_VALUE 0x2060A0
+
+//
+// Top-level wrapper functions
+//
+void Convolution2dRuntimeWrapper(ImgT3 &InImg, ImgT3 &OutImg,
+                                 int Coeffs[5][5]) {
+    #pragma HLS function top
+    #pragma HLS interface argument(Coeffs) type(axi_target)
+    vision::Convolution_2d_Runtime<5, vision::BORDER_REFLECT_101>(
+        InImg, OutImg, Coeffs);
+}
+
+void SeparableConvolution2dWrapper(ImgT1 &InImg, ImgT1 &OutImg) {
+    #pragma HLS function top
+    vision::SeparableConvolution_2d<5, vision::BORDER_REPLICATE>(
+        InImg, OutImg, SepKernelX, SepKernelY);
+}
+
+void SeparableConvolution2dRuntimeWrapper(ImgT3N2 &InImg, ImgT3N2 &OutImg,
+                                          int CoeffsX[3], int CoeffsY[3]) {
+    #pragma HLS function top
+    #pragma HLS interface argument(CoeffsX) type(axi_target)
+    #pragma HLS interface argument(CoeffsY) type(axi_target)
+    vision::SeparableConvolution_2d_Runtime<3, vision::BORDER_CONSTANT>(
+        InImg, OutImg, CoeffsX, CoeffsY, BORDER_VALUE);
+}
+
+//
+// OpenCV reference. The border is added with cv::copyMakeBorder(), so that
+// BORDER_CONSTANT can be checked with a non-zero value, and the sums are
+// computed in float, which is exact for these integer kernels. The sums are
+// then rounded half up like the HLS convolution (converting the float result
+// of cv::filter2D to 8 bits would round half to even).
+//
+void convolutionReference(Mat &InMat, Mat &OutMat, const Mat &Kernel,
+                          int CvBorder, cv::Scalar BorderValue = 0) {
+    const int Radius = Kernel.rows / 2;
+    Mat Padded, Sum;
+    cv::copyMakeBorder(InMat, Padded, Radius, Radius, Radius, Radius, CvBorder,
+                       BorderValue);
+    Padded.convertTo(Padded, CV_32F);
+    cv::filter2D(Padded, Sum, CV_32F, Kernel);
+    Sum = Sum(cv::Rect(Radius, Radius, InMat.cols, InMat.rows));
+
+    OutMat.create(InMat.size(), InMat.type());
+    for (int y = 0; y < InMat.rows; y++) {
+        const float *SumRow = Sum.ptr<float>(y);
+        unsigned char *OutRow = OutMat.ptr<unsigned char>(y);
+        for (int x = 0; x < InMat.cols * InMat.channels(); x++)
+            OutRow[x] = cv::saturate_cast<unsigned char>(
+                cvFloor((SumRow[x] + 128) / 256));
+    }
+}
+
+int compareAndReport(const char *Name, Mat &HlsOutMat, Mat &CvOutMat) {
+    float ErrPercent = vision::compareMat(HlsOutMat, CvOutMat, 0);
+    printf("%s: percentage of pixels over the threshold: %0.2lf%\n", Name,
+           ErrPercent);
+    return (ErrPercent != 0.0);
+}
+
+int main(int argc, char* argv[]) {
+    //
+    // Load image from file using OpenCV's imread function
+    //
+    std::string INPUT_IMAGE=argv[1];
+    Mat InMat = cv::imread(INPUT_IMAGE, cv::IMREAD_COLOR);
+    Mat InMatGray = cv::imread(INPUT_IMAGE, cv::IMREAD_GRAYSCALE);
+    int error = 0;
+
+    //
+    // Convolution_2d_Runtime, 8UC3, BORDER_REFLECT_101
+    //
+    {
+        ImgT3 InImg, OutImg;
+        convertFromCvMat(InMat, InImg);
+        Convolution2dRuntimeWrapper(InImg, OutImg, Coeffs2D);
+
+        Mat Kernel(5, 5, CV_32F), CvOutMat, HlsOutMat;
+        for (int i = 0; i < 5; i++)
+            for (int j = 0; j < 5; j++)
+                Kernel.at<float>(i, j) = Coeffs2D[i][j];
+        convolutionReference(InMat, CvOutMat, Kernel, cv::BORDER_REFLECT_101);
+
+        convertToCvMat(OutImg, HlsOutMat);
+        cv::imwrite("hls_output_2d.bmp", HlsOutMat);
+        cv::imwrite("cv_output_2d.bmp", CvOutMat);
+        error |= compareAndReport("Convolution_2d_Runtime", HlsOutMat, CvOutMat);
+    }
+
+    //
+    // SeparableConvolution_2d, 8UC1, NPPC_2, BORDER_REPLICATE
+    //
+    {
+        ImgT1 InImg, OutImg;
+        convertFromCvMat(InMatGray, InImg);
+        SeparableConvolution2dWrapper(InImg, OutImg);
+
+        Mat Kernel(5, 5, CV_32F), CvOutMat, HlsOutMat;
+        for (int i = 0; i < 5; i++)
+            for (int j = 0; j < 5; j++)
+                Kernel.at<float>(i, j) = SepKernelY(i) * SepKernelX(j);
+        convolutionReference(InMatGray, CvOutMat, Kernel, cv::BORDER_REPLICATE);
+
+        convertToCvMat(OutImg, HlsOutMat);
+        cv::imwrite("hls_output_sep.bmp", HlsOutMat);
+        cv::imwrite("cv_output_sep.bmp", CvOutMat);
+        error |= compareAndReport("SeparableConvolution_2d", HlsOutMat, CvOutMat);
+    }
+
+    //
+    // SeparableConvolution_2d_Runtime, 8UC3, NPPC_2, BORDER_CONSTANT with a
+    // non-zero value
+    //
+    {
+        ImgT3N2 InImg, OutImg;
+        convertFromCvMat(InMat, InImg);
+        SeparableConvolution2dRuntimeWrapper(InImg, OutImg, CoeffsX, CoeffsY);
+
+        Mat Kernel(3, 3, CV_32F), CvOutMat, HlsOutMat;
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                Kernel.at<float>(i, j) = CoeffsY[i] * CoeffsX[j];
+        cv::Scalar BorderValue(BORDER_VALUE & 0xFF, (BORDER_VALUE >> 8) & 0xFF,
+                               (BORDER_VALUE >> 16) & 0xFF);
+        convolutionReference(InMat, CvOutMat, Kernel, cv::BORDER_CONSTANT,
+                             BorderValue);
+
+        convertToCvMat(OutImg, HlsOutMat);
+        cv::imwrite("hls_output_sep_runtime.bmp", HlsOutMat);
+        cv::imwrite("cv_output_sep_runtime.bmp", CvOutMat);
+        error |= compareAndReport("SeparableConvolution_2d_Runtime", HlsOutMat,
+                                  CvOutMat);
+    }
+
+    printf("%s\n", error ? "FAIL" : "PASS");
+    return error;
+}
@@ -18,16 +18,60 @@ using ImgT = Img<vision::PixelType::HLS_8UC1, HEIGHT, WIDTH, vision::StorageType
         vision::NPPC_2>;
 
 //
-// Top-level wrapper function 
+// Top-level wrapper functions
 // 
-template <vision::PixelType PIXEL_T_IN, vision::PixelType PIXEL_T_OUT,
-          unsigned H, unsigned W, vision::StorageType STORAGE_IN,
-          vision::StorageType STORAGE_OUT, vision::NumPixelsPerCycle NPPC>
+template <vision::BorderType BORDER, vision::PixelType PIXEL_T_IN,
+          vision::PixelType PIXEL_T_OUT, unsigned H, unsigned W,
+          vision::StorageType STORAGE_IN, vision::StorageType STORAGE_OUT,
+          vision::NumPixelsPerCycle NPPC>
 void GaussianBlurWrapper(Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
                      Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg) {
     #pragma HLS function top
     const unsigned KERNEL_SIZE = 5;
-    vision::GaussianBlur<KERNEL_SIZE>(InImg, OutImg);
+    vision::GaussianBlur<KERNEL_SIZE, BORDER>(InImg, OutImg);
+}
+
+// The same filter with the 2D kernel, so that the border is handled by
+// LineBuffer::GetWindow() instead of the separable column sums.
+template <vision::BorderType BORDER, vision::PixelType PIXEL_T_IN,
+          vision::PixelType PIXEL_T_OUT, unsigned H, unsigned W,
+          vision::StorageType STORAGE_IN, vision::StorageType STORAGE_OUT,
+          vision::NumPixelsPerCycle NPPC>
+void GaussianConvolution2dWrapper(Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
+                     Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg) {
+    #pragma HLS function top
+    const unsigned KERNEL_SIZE = 5;
+    vision::Convolution_2d<KERNEL_SIZE, BORDER>(InImg, OutImg,
+                                                vision::GaussianBlurKernel);
+}
+
+//
+// Runs both wrappers with BORDER and compares them with cv::GaussianBlur()
+// using the same border.
+//
+template <vision::BorderType BORDER>
+int testBorder(Mat &InMat, int CvBorder, const char *Name) {
+    ImgT InImg, OutImg;
+    Mat CvOutMat, HlsOutMat;
+    cv::GaussianBlur(InMat, CvOutMat, cv::Size(5, 5), 0, 0, CvBorder);
+    int error = 0;
+
+    convertFromCvMat(InMat, InImg);
+    GaussianBlurWrapper<BORDER>(InImg, OutImg);
+    convertToCvMat(OutImg, HlsOutMat);
+    float ErrPercent = vision::compareMat(HlsOutMat, CvOutMat, 0);
+    printf("GaussianBlur, %s: percentage of pixels over the threshold: "
+           "%0.2lf%\n", Name, ErrPercent);
+    error |= (ErrPercent != 0.0);
+
+    convertFromCvMat(InMat, InImg);
+    GaussianConvolution2dWrapper<BORDER>(InImg, OutImg);
+    convertToCvMat(OutImg, HlsOutMat);
+    ErrPercent = vision::compareMat(HlsOutMat, CvOutMat, 0);
+    printf("Convolution_2d, %s: percentage of pixels over the threshold: "
+           "%0.2lf%\n", Name, ErrPercent);
+    error |= (ErrPercent != 0.0);
+    return error;
 }
 
 int main(int argc, char* argv[]) {
@@ -42,7 +86,7 @@ int main(int argc, char* argv[]) {
     // 
     // Call the SmartHLS top-level function
     // 
-    GaussianBlurWrapper(InImg, OutImg);
+    GaussianBlurWrapper<vision::BORDER_ZERO>(InImg, OutImg);
 
     // 
     // OpenCV result as golden reference
@@ -67,6 +111,14 @@ int main(int argc, char* argv[]) {
     float ErrPercent = vision::compareMat(HlsOutMat, CvOutMat, 0);
     printf("Percentage of pixels over the threshold: %0.2lf%\n", ErrPercent);
         int error = (ErrPercent != 0.0);
+
+    // 
+    // The other border types, which pad with the pixels of the image.
+    // 
+    error |= testBorder<vision::BORDER_REPLICATE>(InMat, cv::BORDER_REPLICATE,
+                                                 "BORDER_REPLICATE");
+    error |= testBorder<vision::BORDER_REFLECT_101>(
+        InMat, cv::BORDER_REFLECT_101, "BORDER_REFLECT_101");
     printf("%s\n", error ? "FAIL" : "PASS");
     return error;
 }
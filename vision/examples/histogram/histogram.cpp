@@ -19,6 +19,8 @@ constexpr int HIST_SIZE = 256;
 // #define STORAGE_TYPE StorageType::FIFO
 
 using ImageT = Img<PixelType::HLS_8UC1, HEIGHT, WIDTH, STORAGE_TYPE, NPPC_1>;
+// Same image with 4 pixels per clock, to test the per-lane sub-histograms.
+using ImageT4 = Img<PixelType::HLS_8UC1, HEIGHT, WIDTH, STORAGE_TYPE, NPPC_4>;
 
 //------------------------------------------------------------------------------
 // Create an image to plot the histogram
@@ -63,6 +65,16 @@ void histogramWrapper (ImageT &InImg, uint32_t hist[HIST_SIZE]) {
     hls::vision::Histogram(InImg, hist);
 }
 
+//------------------------------------------------------------------------------
+void histogramWrapperNPPC4 (ImageT4 &InImg, uint32_t hist[HIST_SIZE]) {
+    #pragma HLS function top
+    #pragma HLS interface default type(axi_target)
+    #pragma HLS interface argument(hist) type(axi_target) dma(false)
+    #pragma HLS interface argument(InImg) type(axi_target) dma(false)
+
+    hls::vision::Histogram(InImg, hist);
+}
+
 //------------------------------------------------------------------------------
 int main(int argc, char* argv[]) {
 
@@ -88,6 +100,14 @@ int main(int argc, char* argv[]) {
     cv::Mat histMatHLS = cv::Mat(1, HIST_SIZE, CV_32SC1, hlsHist);
     plot_histogram(histMatHLS, "output_hist_hls.png");
 
+    // The same with 4 pixels per clock.
+    ImageT4 InImg4;
+    convertFromCvMat(InMat, InImg4);
+    uint32_t hlsHist4[HIST_SIZE] = {0};
+    histogramWrapperNPPC4(InImg4, hlsHist4);
+    cv::Mat histMatHLS4 = cv::Mat(1, HIST_SIZE, CV_32SC1, hlsHist4);
+    plot_histogram(histMatHLS4, "output_hist_hls_nppc4.png");
+
     // 
     // With OpenCV
     //
@@ -105,7 +125,9 @@ int main(int argc, char* argv[]) {
     //
     float ErrPercent = compareMat(histMatHLS, cvHistMat, 0);
     printf("Percentage of over threshold: %0.2lf%\n", ErrPercent);
-    int error = (ErrPercent != 0.0);
+    float ErrPercent4 = compareMat(histMatHLS4, cvHistMat, 0);
+    printf("Percentage of over threshold (NPPC_4): %0.2lf%\n", ErrPercent4);
+    int error = (ErrPercent != 0.0) || (ErrPercent4 != 0.0);
     printf("%s\n", error ? "FAIL" : "PASS");
     return error;
 }
@@ -0,0 +1,206 @@
+#include "vision.hpp"
+#include <opencv2/opencv.hpp>
+
+using namespace hls;
+using cv::Mat;
+using vision::Img;
+
+#ifdef SMALL_TEST_FRAME
+#define WIDTH 100
+#define HEIGHT 56
+#else
+#define WIDTH 1920
+#define HEIGHT 1080
+#endif
+#define SIZE (WIDTH * HEIGHT)
+
+using ImgT = Img<vision::PixelType::HLS_8UC1, HEIGHT, WIDTH, vision::StorageType::FIFO,
+        vision::NPPC_2>;
+using ImgT1 = Img<vision::PixelType::HLS_8UC1, HEIGHT, WIDTH,
+                  vision::StorageType::FIFO, vision::NPPC_1>;
+using ImgT1N4 = Img<vision::PixelType::HLS_8UC1, HEIGHT, WIDTH,
+                    vision::StorageType::FIFO, vision::NPPC_4>;
+using ImgT3N2 = Img<vision::PixelType::HLS_8UC3, HEIGHT, WIDTH,
+                    vision::StorageType::FIFO, vision::NPPC_2>;
+
+// Same structuring element as cv::getStructuringElement(cv::MORPH_CROSS,
+// cv::Size(5, 5)).
+constexpr bool Cross5(int i, int j) { return (i == 2) || (j == 2); }
+
+// Runtime mask. It is not symmetric, so a mask that is flipped or transposed
+// by mistake is caught.
+bool Mask5[5][5] = {
+    {0, 0, 1, 0, 0},
+    {0, 1, 1, 0, 0},
+    {1, 1, 1, 1, 1},
+    {0, 0, 1, 1, 1},
+    {0, 0, 0, 0, 1},
+};
+
+//
+// Top-level wrapper functions
+//
+template <vision::PixelType PIXEL_T_IN, vision::PixelType PIXEL_T_OUT,
+          unsigned H, unsigned W, vision::StorageType STORAGE_IN,
+          vision::StorageType STORAGE_OUT, vision::NumPixelsPerCycle NPPC>
+void MorphologyCloseWrapper(Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
+                     Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg) {
+    #pragma HLS function top
+    const unsigned KERNEL_SIZE = 5;
+    vision::MorphologyClose<KERNEL_SIZE>(InImg, OutImg);
+}
+
+void ErodeWrapper(ImgT1 &InImg, ImgT1 &OutImg) {
+    #pragma HLS function top
+    vision::Erode<3>(InImg, OutImg);
+}
+
+void DilateWrapper(ImgT3N2 &InImg, ImgT3N2 &OutImg) {
+    #pragma HLS function top
+    vision::Dilate<3, vision::BORDER_REPLICATE>(InImg, OutImg);
+}
+
+void ErodeCrossWrapper(ImgT1N4 &InImg, ImgT1N4 &OutImg) {
+    #pragma HLS function top
+    vision::Erode<5>(InImg, OutImg, Cross5);
+}
+
+void MorphologyOpenCrossWrapper(ImgT &InImg, ImgT &OutImg) {
+    #pragma HLS function top
+    vision::MorphologyOpen<5>(InImg, OutImg, Cross5);
+}
+
+void MorphologyRuntimeWrapper(ImgT1N4 &InImg, ImgT1N4 &OutImg,
+                              bool Mask[5][5]) {
+    #pragma HLS function top
+    #pragma HLS interface argument(Mask) type(axi_target)
+    vision::Morphology_Runtime<vision::MORPH_DILATE, 5>(InImg, OutImg, Mask);
+}
+
+int compareAndReport(const char *Name, Mat &HlsOutMat, Mat &CvOutMat) {
+    // Use this commented out line to report location of errors.
+    //  vision::compareMatAndReport<unsigned char>(HlsOutMat, CvOutMat, 0);
+    float ErrPercent = vision::compareMat(HlsOutMat, CvOutMat, 0);
+    printf("%s: percentage of pixels over the threshold: %0.2lf%\n", Name,
+           ErrPercent);
+    return (ErrPercent != 0.0);
+}
+
+int main(int argc, char* argv[]) {
+    //
+    // Load image from file using OpenCV's imread function
+    //
+    std::string INPUT_IMAGE=argv[1];
+    Mat InMat = cv::imread(INPUT_IMAGE, cv::IMREAD_COLOR);
+    Mat InMatGray = cv::imread(INPUT_IMAGE, cv::IMREAD_GRAYSCALE);
+    int error = 0;
+
+    // The OpenCV references use the default border of cv::erode(),
+    // cv::dilate() and cv::morphologyEx(), a constant that never wins the
+    // min or max, which matches the default BORDER_CONSTANT of the HLS
+    // functions.
+    Mat Rect3 = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(3, 3));
+    Mat Rect5 = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(5, 5));
+    Mat CrossElement =
+        cv::getStructuringElement(cv::MORPH_CROSS, cv::Size(5, 5));
+
+    //
+    // MorphologyClose, 8UC1, NPPC_2
+    //
+    {
+        ImgT InImg, OutImg;
+        convertFromCvMat(InMatGray, InImg);
+        MorphologyCloseWrapper(InImg, OutImg);
+
+        Mat CvOutMat, HlsOutMat;
+        cv::morphologyEx(InMatGray, CvOutMat, cv::MORPH_CLOSE, Rect5);
+
+        convertToCvMat(OutImg, HlsOutMat);
+        cv::imwrite("hls_output.bmp", HlsOutMat);
+        cv::imwrite("cv_output.bmp", CvOutMat);
+        error |= compareAndReport("MorphologyClose", HlsOutMat, CvOutMat);
+    }
+
+    //
+    // Erode, 8UC1, NPPC_1
+    //
+    {
+        ImgT1 InImg, OutImg;
+        convertFromCvMat(InMatGray, InImg);
+        ErodeWrapper(InImg, OutImg);
+
+        Mat CvOutMat, HlsOutMat;
+        cv::erode(InMatGray, CvOutMat, Rect3);
+
+        convertToCvMat(OutImg, HlsOutMat);
+        error |= compareAndReport("Erode", HlsOutMat, CvOutMat);
+    }
+
+    //
+    // Dilate, 8UC3, NPPC_2, BORDER_REPLICATE
+    //
+    {
+        ImgT3N2 InImg, OutImg;
+        convertFromCvMat(InMat, InImg);
+        DilateWrapper(InImg, OutImg);
+
+        Mat CvOutMat, HlsOutMat;
+        cv::dilate(InMat, CvOutMat, Rect3, cv::Point(-1, -1), 1,
+                   cv::BORDER_REPLICATE);
+
+        convertToCvMat(OutImg, HlsOutMat);
+        error |= compareAndReport("Dilate", HlsOutMat, CvOutMat);
+    }
+
+    //
+    // Erode with a cross functor mask, 8UC1, NPPC_4
+    //
+    {
+        ImgT1N4 InImg, OutImg;
+        convertFromCvMat(InMatGray, InImg);
+        ErodeCrossWrapper(InImg, OutImg);
+
+        Mat CvOutMat, HlsOutMat;
+        cv::erode(InMatGray, CvOutMat, CrossElement);
+
+        convertToCvMat(OutImg, HlsOutMat);
+        error |= compareAndReport("Erode (cross)", HlsOutMat, CvOutMat);
+    }
+
+    //
+    // MorphologyOpen with a cross functor mask, 8UC1, NPPC_2
+    //
+    {
+        ImgT InImg, OutImg;
+        convertFromCvMat(InMatGray, InImg);
+        MorphologyOpenCrossWrapper(InImg, OutImg);
+
+        Mat CvOutMat, HlsOutMat;
+        cv::morphologyEx(InMatGray, CvOutMat, cv::MORPH_OPEN, CrossElement);
+
+        convertToCvMat(OutImg, HlsOutMat);
+        error |= compareAndReport("MorphologyOpen (cross)", HlsOutMat,
+                                  CvOutMat);
+    }
+
+    //
+    // Morphology_Runtime, MORPH_DILATE with a runtime mask, 8UC1, NPPC_4
+    //
+    {
+        ImgT1N4 InImg, OutImg;
+        convertFromCvMat(InMatGray, InImg);
+        MorphologyRuntimeWrapper(InImg, OutImg, Mask5);
+
+        Mat Element(5, 5, CV_8U), CvOutMat, HlsOutMat;
+        for (int i = 0; i < 5; i++)
+            for (int j = 0; j < 5; j++)
+                Element.at<unsigned char>(i, j) = Mask5[i][j];
+        cv::dilate(InMatGray, CvOutMat, Element);
+
+        convertToCvMat(OutImg, HlsOutMat);
+        error |= compareAndReport("Morphology_Runtime", HlsOutMat, CvOutMat);
+    }
+
+    printf("%s\n", error ? "FAIL" : "PASS");
+    return error;
+}
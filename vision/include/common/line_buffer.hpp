@@ -22,6 +22,7 @@
 #define __SHLS_VISION_LINE_BUFFER_H__
 
 #include <math.h>
+#include "params.hpp"
 namespace hls {
 namespace sev {
 
@@ -40,8 +41,210 @@ namespace sev {
 // - Then your filter can access the window by "line_buffer.window[i][j]".
 
 template <typename PixelType, unsigned ImageWidth, unsigned WindowSize,
-          unsigned BitWidth = 8, unsigned NPPC = 1, bool LowRamUsage = false>
-class LineBuffer {};
+          unsigned BitWidth = 8, unsigned NPPC = 1, bool LowRamUsage = false,
+          bool PackedRows = false>
+class LineBuffer {
+    // Only reached for LowRamUsage = PackedRows = true, every other
+    // combination has its own specialisation below.
+    static_assert(!(LowRamUsage && PackedRows),
+                  "LineBuffer: LowRamUsage and PackedRows cannot both be true, "
+                  "select one storage (see LineBufferStorage).");
+};
+
+// Maps coordinate `v` of a row or column of `Size` pixels to the pixel that
+// BORDER pads it with. For BORDER_ZERO and BORDER_CONSTANT, `v` is returned
+// unchanged and the caller checks whether it is inside the image.
+template <vision::BorderType BORDER>
+int BorderMap(int v, unsigned Size) {
+    int Last = int(Size) - 1;
+    if (BORDER == vision::BORDER_REPLICATE)
+        return (v < 0) ? 0 : (v > Last) ? Last : v;
+    if (BORDER == vision::BORDER_REFLECT_101)
+        return (v < 0) ? -v : (v > Last) ? 2 * Last - v : v;
+    return v;
+}
+
+/******************************************************************************************
+ * @brief  LineBufferWindow  –  the sliding window shared by the LineBuffer
+ *         specialisations.
+ *
+ * Holds the `WindowSize × WindowSize` window of pixel words and the functions that
+ * access the NPPC windows of the pixels in its centre word. Both the default and the
+ * LowRamUsage LineBuffer shift their words into `window` the same way, so the access
+ * functions work with either storage layout of the previous rows.
+ ******************************************************************************************/
+template <typename PixelType, unsigned WindowSize, unsigned BitWidth,
+          unsigned NPPC>
+class LineBufferWindow {
+  public:
+    /**
+     * @brief Current @p WindowSize × @p WindowSize neighbourhood.
+     *
+     * After every call to @ref ShiftInPixel the window is left-aligned
+     * with the most recent pixel:
+     * ```
+     *                ← x
+     *         +-------------------+
+     *   y  ↑  | w[y][x] …        |
+     *         +-------------------+
+     * ```
+     */
+    PixelType window[WindowSize][WindowSize];
+
+    // The line buffer maintains NPPC number of WindowSize x WindowSize windows.
+    // For example, say NPPC is 4 and WindowSize is 3, the windows array will
+    // have the following 9 words, each word contains 4 pixels.
+    //
+    // a0.a1.a2.a3  b0.b1.b2.b3  c0.c1.c2.c3
+    // d0.d1.d2.d3  e0.e1.e2.e3  f0.f1.f2.f3
+    // g0.g1.g2.g3  h0.h1.h2.h3  i0.i1.i2.i3
+    //
+    // The user algorithm should be processing the "receptive" fields for the 4
+    // pixels in word e.  So calling
+    //   AccessWindow(x, y, 0) returns pixels in the receptive field for e0.
+    //   - AccessWindow(0, 0, 0) gives a3
+    //   - AccessWindow(1, 1, 0) gives e0
+    //   - AccessWindow(2, 2, 0) gives h1
+    //
+    //   AccessWindow(x, y, 2) returns pixels in the receptive field for e2.
+    //   - AccessWindow(2, 0, 2) gives b3
+    //
+    // x, y coordinates in a window where the centroid is at the k-th pixel.
+    ap_uint<BitWidth> AccessWindow(unsigned x, unsigned y, unsigned k) {
+        // The radius of 3x3 is 1, radius of 5x5 is 2, radius of 7x7 is 3.
+        const unsigned WindowRadius = (WindowSize - 1) / 2;
+        // Map k into j & pixel_offset
+        // - k ranges from 0 to NPPC - 1
+        // - j ranges from 0 to WindowSize, to index window
+        // - pixel_offset range from 0 to NPPC - 1, to index a window element
+        //
+        // Say the window has WindowSize * NPPC columns, the column index of
+        // the centroid pixel is:
+        unsigned centroid_col = WindowRadius * NPPC + k;
+        // Now the corresponding pixel at y = 0 is (WindowSize - 1) / 2 pixels
+        // to the left of the centroid.
+        unsigned col_idx = centroid_col - WindowRadius + y;
+
+        unsigned j = col_idx / NPPC;
+        unsigned pixel_offset = col_idx - j * NPPC;
+
+        return window[x][j].byte(pixel_offset, BitWidth);
+    }
+
+    // Returns in `Out` the window of pixel k of the word at (Row, ColWord),
+    // i.e. Out[x][y] = AccessWindow(x, y, k), with the taps outside of the
+    // ImgHeight x ImgWidth image replaced according to BORDER. The rows are
+    // remapped first and then the columns, so every tap goes through two
+    // WindowSize:1 muxes instead of one WindowSize^2:1 mux. BorderValue is
+    // only used by BORDER_CONSTANT.
+    // BORDER_REFLECT_101 requires the image to be larger than the radius of
+    // the window.
+    template <vision::BorderType BORDER = vision::BORDER_ZERO>
+    void GetWindow(ap_uint<BitWidth> Out[WindowSize][WindowSize], int Row,
+                   int ColWord, unsigned k, unsigned ImgHeight,
+                   unsigned ImgWidth, ap_uint<BitWidth> BorderValue = 0) {
+        // Source row/column (within the window) of every row/column of Out.
+        unsigned SrcX[WindowSize], SrcY[WindowSize];
+        bool ValidX[WindowSize], ValidY[WindowSize];
+        BorderSources<BORDER>(Row, ImgHeight, SrcY, ValidY);
+        BorderSources<BORDER>(ColWord * NPPC + k, ImgWidth, SrcX, ValidX);
+
+        const ap_uint<BitWidth> Padding = (BORDER == vision::BORDER_CONSTANT)
+                                              ? BorderValue
+                                              : ap_uint<BitWidth>(0);
+
+        // 1. Rows: row x of Out is row SrcY[x] of the window.
+        ap_uint<BitWidth> Rows[WindowSize][WindowSize];
+        for (int x = 0; x < WindowSize; x++)
+            for (int y = 0; y < WindowSize; y++)
+                Rows[x][y] = ValidY[x] ? AccessWindow(SrcY[x], y, k) : Padding;
+
+        // 2. Columns: column y of Out is column SrcX[y] of Rows.
+        for (int x = 0; x < WindowSize; x++)
+            for (int y = 0; y < WindowSize; y++)
+                Out[x][y] = ValidX[y] ? Rows[x][SrcX[y]] : Padding;
+    }
+
+    // Returns in Src[d] the row (or column) of the window, from 0 to
+    // WindowSize - 1, that row (or column) Pos + d - WindowRadius of an image
+    // Size pixels high (or wide) is padded with according to BORDER. Valid[d]
+    // is false where the padding is a constant instead, Src[d] then stays
+    // inside the window but is not meant to be read.
+    template <vision::BorderType BORDER>
+    static void BorderSources(int Pos, unsigned Size,
+                              unsigned Src[WindowSize],
+                              bool Valid[WindowSize]) {
+        const int WindowRadius = (WindowSize - 1) / 2;
+        for (int d = 0; d < WindowSize; d++) {
+            int Mapped = BorderMap<BORDER>(Pos + d - WindowRadius, Size);
+            int S = Mapped - Pos + WindowRadius;
+            Src[d] = (S >= 0 && S < int(WindowSize)) ? S : d;
+            Valid[d] = (Mapped >= 0) & (Mapped < int(Size));
+        }
+    }
+
+    // BorderSources() for the columns around pixel k of the word at ColWord,
+    // with Src[d] numbered as the pixel columns of the window, from 0 to
+    // WindowSize * NPPC - 1, like in AccessWindow(): pixel k is column
+    // WindowRadius * NPPC + k. Used by the filters that keep one result per
+    // pixel column of the window (see LineBufferColumnCache).
+    template <vision::BorderType BORDER>
+    static void BorderPixelColumns(int ColWord, unsigned k, unsigned ImgWidth,
+                                   unsigned Src[WindowSize],
+                                   bool Valid[WindowSize]) {
+        const unsigned WindowRadius = (WindowSize - 1) / 2;
+        BorderSources<BORDER>(ColWord * NPPC + k, ImgWidth, Src, Valid);
+        for (int d = 0; d < WindowSize; d++)
+            Src[d] += WindowRadius * (NPPC - 1) + k;
+    }
+
+    void print_window(unsigned k) {
+        for (int i = 0; i < WindowSize; i++) {
+            for (int j = 0; j < WindowSize; j++) {
+                printf("%x ", int(AccessWindow(i, j, k)));
+            }
+            printf("\n");
+        }
+    }
+};
+
+// The per-column results of the filters that reduce every column of the
+// LineBuffer window once, when it enters the window, instead of once for every
+// output pixel that uses it. Column[w][k][c] is the result of channel c of
+// pixel k of word w of the window. Row and Col are the position of the newest
+// column, in pixel words, relative to the row and column of the output.
+template <unsigned WindowSize, unsigned NPPC, unsigned CHANNELS, typename T>
+struct LineBufferColumnCache {
+    T Column[WindowSize][NPPC][CHANNELS];
+    int Row;
+    unsigned Col;
+
+    // The first pixel word read is WindowRadius rows above the output.
+    void Reset() {
+        Row = -int((WindowSize - 1) / 2);
+        Col = 0;
+    }
+
+    // Shifts the columns along with the window, Column[WindowSize - 1] is then
+    // left for the newest column.
+    void ShiftColumns() {
+        for (int w = 0; w < WindowSize - 1; w++)
+            for (int k = 0; k < NPPC; k++)
+                for (int c = 0; c < CHANNELS; c++)
+                    Column[w][k][c] = Column[w + 1][k][c];
+    }
+
+    // Moves Row and Col to the next pixel word of an image ImgWords pixel
+    // words wide.
+    void NextWord(unsigned ImgWords) {
+        if (Col == ImgWords - 1) {
+            Col = 0;
+            Row++;
+        } else {
+            Col++;
+        }
+    }
+};
 
 /******************************************************************************************
  * @brief  LineBuffer  –  2-D sliding-window buffer for streaming image processing
@@ -64,32 +267,20 @@ class LineBuffer {};
  * ---------------------------------------------------------------------
  * | Parameter    | Meaning                                            |
  * |--------------|----------------------------------------------------|
- * | PixelType    | C++ type that stores one pixel (e.g. `uint8_t`)    |
- * | ImageWidth   | Width of the full frame in pixels                  |
+ * | PixelType    | C++ type that stores one word of NPPC pixels       |
+ * | ImageWidth   | Width of the full frame in words (pixels / NPPC)   |
  * | WindowSize   | Side length of the sliding window (e.g. 3, 5, 7)   |
- * | BitWidth     | Reserved – not used by this specialisation         |
- * | NPPC         | Pixels-Per-Clock (must be 1 for this version)      |
+ * | BitWidth     | Width of one pixel of a word (used by AccessWindow)|
+ * | NPPC         | Pixels-Per-Clock, i.e. pixels per word             |
  * -------------------------------------------------------------------------
  *
  ******************************************************************************************/
 template <typename PixelType, unsigned ImageWidth, unsigned WindowSize,
           unsigned BitWidth, unsigned NPPC>
-class LineBuffer<PixelType, ImageWidth, WindowSize, BitWidth, NPPC, false> {
+class LineBuffer<PixelType, ImageWidth, WindowSize, BitWidth, NPPC, false>
+    : public LineBufferWindow<PixelType, WindowSize, BitWidth, NPPC> {
   public:
-
-    /**
-     * @brief Current @p WindowSize × @p WindowSize neighbourhood.
-     *
-     * After every call to @ref ShiftInPixel the window is left-aligned
-     * with the most recent pixel:
-     * ```
-     *                ← x
-     *         +-------------------+
-     *   y  ↑  | w[y][x] …        |
-     *         +-------------------+
-     * ```
-     */
-    PixelType window[WindowSize][WindowSize];
+    using LineBufferWindow<PixelType, WindowSize, BitWidth, NPPC>::window;
 
     /**
      * @brief Shifts a new pixel into the sliding window buffer, updating the window and
@@ -150,55 +341,6 @@ class LineBuffer<PixelType, ImageWidth, WindowSize, BitWidth, NPPC, false> {
             (prev_row_index == ImageWidth - 1) ? 0 : prev_row_index + 1;
     }
 
-    // The line buffer maintains NPPC number of WindowSize x WindowSize windows.
-    // For example, say NPPC is 4 and WindowSize is 3, the windows array will
-    // have the following 9 words, each word contains 4 pixels.
-    //
-    // a0.a1.a2.a3  b0.b1.b2.b3  c0.c1.c2.c3
-    // d0.d1.d2.d3  e0.e1.e2.e3  f0.f1.f2.f3
-    // g0.g1.g2.g3  h0.h1.h2.h3  i0.i1.i2.i3
-    //
-    // The user algorithm should be processing the "receptive" fields for the 4
-    // pixels in word e.  So calling
-    //   AccessWindow(x, y, 0) returns pixels in the receptive field for e0.
-    //   - AccessWindow(0, 0, 0) gives a3
-    //   - AccessWindow(1, 1, 0) gives e0
-    //   - AccessWindow(2, 2, 0) gives h1
-    //
-    //   AccessWindow(x, y, 2) returns pixels in the receptive field for e2.
-    //   - AccessWindow(2, 0, 2) gives b3
-    //
-    // x, y coordinates in a window where the centroid is at the k-th pixel.
-    ap_uint<BitWidth> AccessWindow(unsigned x, unsigned y, unsigned k) {
-        // The radius of 3x3 is 1, radius of 5x5 is 2, radius of 7x7 is 3.
-        const unsigned WindowRadius = (WindowSize - 1) / 2;
-        // Map k into j & pixel_offset
-        // - k ranges from 0 to NPPC - 1
-        // - j ranges from 0 to WindowSize, to index window
-        // - pixel_offset range from 0 to NPPC - 1, to index a window element
-        //
-        // Say the window has WindowSize * NPPC columns, the column index of
-        // the centroid pixel is:
-        unsigned centroid_col = WindowRadius * NPPC + k;
-        // Now the corresponding pixel at y = 0 is (WindowSize - 1) / 2 pixels
-        // to the left of the centroid.
-        unsigned col_idx = centroid_col - WindowRadius + y;
-
-        unsigned j = col_idx / NPPC;
-        unsigned pixel_offset = col_idx - j * NPPC;
-
-        return window[x][j].byte(pixel_offset, BitWidth);
-    }
-
-    void print_window(unsigned k) {
-        for (int i = 0; i < WindowSize; i++) {
-            for (int j = 0; j < WindowSize; j++) {
-                printf("%x ", int(AccessWindow(i, j, k)));
-            }
-            printf("\n");
-        }
-    }
-
   private:
     unsigned prev_row_index = 0;
     PixelType prev_row[WindowSize - 1][ImageWidth];
@@ -208,7 +350,7 @@ class LineBuffer<PixelType, ImageWidth, WindowSize, BitWidth, NPPC, false> {
  * @brief  LineBuffer  –  2-D sliding-window buffer for streaming image processing
  *
  * This partial-specialisation is used when a @p true compile-time flag selects the
- * “scalar-pixel / single-pixel-per-cycle” implementation.  It maintains a square
+ * low-RAM implementation.  It maintains a square
  * `WindowSize × WindowSize` window over a raster-scanned stream and exposes it as
  * the public data-member `window`.  On every call to `ShiftInPixel()` one new pixel is
  * pushed in (the latest sample arriving from the right) and the window contents are
@@ -219,37 +361,31 @@ class LineBuffer<PixelType, ImageWidth, WindowSize, BitWidth, NPPC, false> {
  *
  * Internally the class stores the last (WindowSize-1) image rows in a linearised
  * ring-buffer (`prev_row[]`) so that only O(WindowSize²) on-chip memory is required,
- * independent of the full image height.
+ * independent of the full image height. Unlike the default specialisation, which
+ * keeps one `prev_row` array per row, all the rows share one deeper array, so a
+ * frame that is narrow in words (e.g. a 4K frame with NPPC 4) packs into fewer
+ * BRAMs. With NPPC > 1 every “pixel” above is a word of NPPC pixels, and the
+ * window of each pixel of the centre word is read with AccessWindow() or
+ * GetWindow(), as with the default specialisation.
  *
  * Template parameters
  * ---------------------------------------------------------------------
  * | Parameter    | Meaning                                            |
  * |--------------|----------------------------------------------------|
- * | PixelType    | C++ type that stores one pixel (e.g. `uint8_t`)    |
- * | ImageWidth   | Width of the full frame in pixels                  |
+ * | PixelType    | C++ type that stores one word of NPPC pixels       |
+ * | ImageWidth   | Width of the full frame in words (pixels / NPPC)   |
  * | WindowSize   | Side length of the sliding window (e.g. 3, 5, 7)   |
- * | BitWidth     | Reserved – not used by this specialisation         |
- * | NPPC         | Pixels-Per-Clock (must be 1 for this version)      |
+ * | BitWidth     | Width of one pixel of a word (used by AccessWindow)|
+ * | NPPC         | Pixels-Per-Clock, i.e. pixels per word             |
  * -------------------------------------------------------------------------
  *
  ******************************************************************************************/
 template <typename PixelType, unsigned ImageWidth, unsigned WindowSize,
           unsigned BitWidth, unsigned NPPC>
-class LineBuffer<PixelType, ImageWidth, WindowSize, BitWidth, NPPC, true> {
+class LineBuffer<PixelType, ImageWidth, WindowSize, BitWidth, NPPC, true>
+    : public LineBufferWindow<PixelType, WindowSize, BitWidth, NPPC> {
   public:
-    /**
-     * @brief Current @p WindowSize × @p WindowSize neighbourhood.
-     *
-     * After every call to @ref ShiftInPixel the window is left-aligned
-     * with the most recent pixel:
-     * ```
-     *                ← x
-     *         +-------------------+
-     *   y  ↑  | w[y][x] …        |
-     *         +-------------------+
-     * ```
-     */
-    PixelType window[WindowSize][WindowSize];
+    using LineBufferWindow<PixelType, WindowSize, BitWidth, NPPC>::window;
 
     /**
      * @brief Push one new pixel from the image stream and update the window.
@@ -310,6 +446,84 @@ class LineBuffer<PixelType, ImageWidth, WindowSize, BitWidth, NPPC, true> {
     PixelType prev_row[(WindowSize - 1) * ImageWidth];
 };
 
+/******************************************************************************************
+ * @brief  LineBuffer  –  2-D sliding-window buffer with packed previous rows
+ *
+ * This partial-specialisation is used when @p PackedRows is true. The window is the
+ * same as in the default specialisation, but the (WindowSize-1) previous rows are
+ * concatenated into one word per column:
+ *
+ *     prev_rows[column] = { row -(WindowSize-1), …, row -2, row -1 }
+ *                           (row -1, the most recent one, in the low bits)
+ *
+ * so every call to `ShiftInPixel()` does exactly one read and one write of a single
+ * (WindowSize-1) * BitWidth * NPPC bits wide memory, instead of one access to each of
+ * the (WindowSize-1) narrow row arrays. A wide and shallow memory maps onto fewer
+ * LSRAM blocks than several narrow ones, e.g. for a 7x7 window over a 3840-pixel
+ * `HLS_8UC1` row with NPPC 4, one 192-bit x 960 memory instead of six 32-bit x 960
+ * ones.
+ *
+ * Template parameters
+ * ---------------------------------------------------------------------
+ * | Parameter    | Meaning                                            |
+ * |--------------|----------------------------------------------------|
+ * | PixelType    | C++ type that stores one word of NPPC pixels       |
+ * | ImageWidth   | Width of the full frame in words (pixels / NPPC)   |
+ * | WindowSize   | Side length of the sliding window (e.g. 3, 5, 7)   |
+ * | BitWidth     | Width of one pixel of a word                       |
+ * | NPPC         | Pixels-Per-Clock, i.e. pixels per word             |
+ * -------------------------------------------------------------------------
+ *
+ ******************************************************************************************/
+template <typename PixelType, unsigned ImageWidth, unsigned WindowSize,
+          unsigned BitWidth, unsigned NPPC>
+class LineBuffer<PixelType, ImageWidth, WindowSize, BitWidth, NPPC, false, true>
+    : public LineBufferWindow<PixelType, WindowSize, BitWidth, NPPC> {
+  public:
+    using LineBufferWindow<PixelType, WindowSize, BitWidth, NPPC>::window;
+
+    static const unsigned WordWidth = BitWidth * NPPC;
+    using PackedRowsT = ap_uint<(WindowSize - 1) * WordWidth>;
+
+    void ShiftInPixel(PixelType input_pixel) {
+        // Shift existing window to the left by one.
+        for (unsigned i = 0; i < WindowSize; i++) {
+            for (unsigned j = 0; j < WindowSize - 1; j++) {
+                window[i][j] = window[i][j + 1];
+            }
+        }
+
+        // The only read of the line buffer memory.
+        PackedRowsT Column = prev_rows[prev_row_index];
+
+        // Grab next column (the rightmost column of the sliding window).
+        for (unsigned i = 0; i < WindowSize; i++) {
+            window[i][WindowSize - 1] =
+                (i == WindowSize - 1)
+                    ? input_pixel
+                    : PixelType(Column.byte(WindowSize - 2 - i, WordWidth));
+        }
+
+        // The new pixel becomes the most recent row, the oldest row is
+        // dropped. This is the only write of the line buffer memory.
+        PackedRowsT NextColumn;
+        NextColumn.byte(0, WordWidth) = ap_uint<WordWidth>(input_pixel);
+        for (unsigned i = 1; i < WindowSize - 1; i++)
+            NextColumn.byte(i, WordWidth) = Column.byte(i - 1, WordWidth);
+        prev_rows[prev_row_index] = NextColumn;
+
+        prev_row_index =
+            (prev_row_index == ImageWidth - 1) ? 0 : prev_row_index + 1;
+    }
+
+  private:
+    unsigned prev_row_index = 0;
+    // One column of (WindowSize - 1) packed rows per word. Don't partition
+    // it, it has to stay a single memory to get one read and one write per
+    // call.
+    PackedRowsT prev_rows[ImageWidth];
+};
+
 // Specialization when the WindowSize is 1.
 template <typename PixelType, unsigned ImageWidth, unsigned BitWidth,
           unsigned NPPC>
@@ -325,14 +539,31 @@ class LineBuffer<PixelType, ImageWidth, 1, BitWidth, NPPC, false> {
     PixelType window[1][1];
     void ShiftInPixel(PixelType input_pixel) { window[0][0] = input_pixel; }
 };
+template <typename PixelType, unsigned ImageWidth, unsigned BitWidth,
+          unsigned NPPC>
+class LineBuffer<PixelType, ImageWidth, 1, BitWidth, NPPC, false, true> {
+  public:
+    PixelType window[1][1];
+    void ShiftInPixel(PixelType input_pixel) { window[0][0] = input_pixel; }
+};
 
 } // End of namespace vision.
 
 namespace vision {
 template <typename PixelType, unsigned ImageWidth, unsigned WindowSize,
-          unsigned BitWidth = 8, unsigned NPPC = 1, bool LowRamUsage = false>
+          unsigned BitWidth = 8, unsigned NPPC = 1, bool LowRamUsage = false,
+          bool PackedRows = false>
 using LineBuffer = sev::LineBuffer<PixelType, ImageWidth, WindowSize, BitWidth,
-                                   NPPC, LowRamUsage>;
+                                   NPPC, LowRamUsage, PackedRows>;
+
+// The LineBuffer specialisation selected by LineBufferStorage, as used by the
+// filters that take the storage as a template parameter.
+template <typename PixelType, unsigned ImageWidth, unsigned WindowSize,
+          unsigned BitWidth, unsigned NPPC, LineBufferStorage LB_STORAGE>
+using LineBufferWithStorage =
+    sev::LineBuffer<PixelType, ImageWidth, WindowSize, BitWidth, NPPC,
+                    LB_STORAGE == LINE_BUFFER_LOW_RAM,
+                    LB_STORAGE == LINE_BUFFER_PACKED_ROWS>;
 }
 
 } // End of namespace hls.
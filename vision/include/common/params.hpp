@@ -68,6 +68,32 @@ enum BayerFormat {
     BGGR = 3
 };
 
+// How the window of a LineBuffer is padded where it extends outside of the
+// image (see LineBuffer::GetWindow()). With a row `abcdefgh`:
+//   BORDER_ZERO:        000|abcdefgh|000
+//   BORDER_CONSTANT:    vvv|abcdefgh|vvv (v given at runtime)
+//   BORDER_REPLICATE:   aaa|abcdefgh|hhh
+//   BORDER_REFLECT_101: dcb|abcdefgh|gfe (OpenCV's default)
+enum BorderType {
+    BORDER_ZERO = 0,
+    BORDER_CONSTANT = 1,
+    BORDER_REPLICATE = 2,
+    BORDER_REFLECT_101 = 3
+};
+
+// How a LineBuffer stores the previous image rows (see line_buffer.hpp). The
+// filters built on the LineBuffer take it as a template parameter:
+//   LINE_BUFFER_DEFAULT: one memory per row.
+//   LINE_BUFFER_LOW_RAM: all the rows in one deeper memory (LowRamUsage),
+//                        fewer BRAMs when a row is short in words.
+//   LINE_BUFFER_PACKED_ROWS: all the rows in one wider memory (PackedRows),
+//                            one read and one write per pixel word.
+enum LineBufferStorage {
+    LINE_BUFFER_DEFAULT = 0,
+    LINE_BUFFER_LOW_RAM = 1,
+    LINE_BUFFER_PACKED_ROWS = 2
+};
+
 /**
  * This struct is used to convert the combination of pixels per clock and pixel
  * type to an ap_uint (or ap_int if using a signed type) of size DT.W bits
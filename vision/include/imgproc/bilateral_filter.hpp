@@ -26,30 +26,26 @@
 #include "../common/common.hpp"
 #include "../common/utils.hpp"
 #include "hls/ap_fixpt.hpp"
+#include "../../../math/include/hls_reciprocal.hpp"
 
 namespace hls {
 namespace vision {
 
 template <
     unsigned FILTER_SIZE = 5,
+    BorderType BORDER = BORDER_ZERO,
     PixelType PIXEL_T_IN, 
     PixelType PIXEL_T_OUT,
     unsigned H, 
     unsigned W, 
     StorageType STORAGE_IN,
     StorageType STORAGE_OUT, 
-    NumPixelsPerCycle NPPC
+    NumPixelsPerCycle NPPC,
+    typename LineBufferT
 > void BilateralProcess (
     vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
     vision::Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg,
-    LineBuffer<
-        typename DT<PIXEL_T_IN, NPPC>::T, 
-        W / NPPC, 
-        FILTER_SIZE,
-        DT<PIXEL_T_IN, 
-        NPPC>::W / NPPC, 
-        unsigned(NPPC)
-    > &LineBuffer,
+    LineBufferT &LineBuffer,
     unsigned &i, 
     unsigned &j,
     const GaussianIntensityTable<256> &GI,
@@ -71,19 +67,19 @@ template <
     const int FilterRadius = (FILTER_SIZE-1) / (FILTER_SIZE/2); // e.g., 2 if FILTER_SIZE is 5.
     TmpPixelT centerPix = TmpPixelT(LineBuffer.AccessWindow(FilterRadius, FilterRadius, 0));
 
+    // Get the input window from LineBuffer, padded according to BORDER where it
+    // extends outside of the image.
+    ap_uint<InPixelWidth> Window[FILTER_SIZE][FILTER_SIZE];
+    LineBuffer.template GetWindow<BORDER>(Window, i, j, 0, ImgHeight, ImgWidth);
+
     ap_uint<32> Wp = 0, Sum = 0;
     HLS_VISION_BILATERAL_LOOP2A:
     for (int OffsetY = -FilterRadius; OffsetY <= FilterRadius; OffsetY++) {
         HLS_VISION_BILATERAL_LOOP2B:
         for (int OffsetX = -FilterRadius; OffsetX <= FilterRadius; OffsetX++) {
-            int y = i + OffsetY;
-            int x = j * NPPC + OffsetX;
-            bool WindowOutOfBounds = (y < 0) | (y >= ImgHeight) | (x < 0) | (x >= ImgWidth);
             int ArrayIdxY = OffsetY + FilterRadius;
             int ArrayIdxX = OffsetX + FilterRadius;
-            TmpPixelT WindowPix = WindowOutOfBounds ? 
-                TmpPixelT(0) : 
-                TmpPixelT(LineBuffer.AccessWindow(ArrayIdxY, ArrayIdxX, 0));
+            TmpPixelT WindowPix = TmpPixelT(Window[ArrayIdxY][ArrayIdxX]);
             ap_int<9> d = (WindowPix - centerPix);
             if (d<0) d = -d;
             auto gi = GI.getIntensity(d.to_uint64());
@@ -94,7 +90,18 @@ template <
         }
     }
 
-    Sum = Sum / Wp;
+    // Wp is never 0 since the centre pixel always has the largest weight. The
+    // quotient is a weighted average of pixels, so it fits in 8 integer bits;
+    // a reciprocal-based divide avoids a 32-bit divider in the pixel loop.
+    // The estimate can be off by one, so it is corrected with the remainder to
+    // give exactly floor(Sum / Wp).
+    ap_uint<9> Quotient = hls::math::divide<16, 9, 1>(ap_ufixpt<32, 32>(Sum), ap_ufixpt<32, 32>(Wp)).raw_bits() >> 7;
+    ap_uint<42> Product = ap_uint<42>(Quotient) * Wp;
+    if (Product > Sum)
+        Quotient--;
+    else if (Product + Wp <= Sum)
+        Quotient++;
+    Sum = Quotient;
     const TmpPixelT OutMaxPixelVal = TmpPixelT(255);
 
     TmpPixelT PSum = (TmpPixelT(Sum) > OutMaxPixelVal) ? OutMaxPixelVal : TmpPixelT(Sum);
@@ -113,6 +120,8 @@ template <
 
 template <
     unsigned FILTER_SIZE, 
+    BorderType BORDER = BORDER_ZERO,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
     PixelType PIXEL_T, 
     unsigned H, 
     unsigned W, 
@@ -164,7 +173,8 @@ void BilateralFilter(
     const unsigned InPixelWidth = DT<PIXEL_T, NPPC>::W / NPPC;
 
 
-    LineBuffer<InPixelWordT, W / NPPC, FILTER_SIZE, InPixelWidth, NPPC>
+    LineBufferWithStorage<InPixelWordT, W / NPPC, FILTER_SIZE, InPixelWidth,
+                          NPPC, LB_STORAGE>
         LineBuffer;
     const unsigned FilterRadius = (FILTER_SIZE-1) / (FILTER_SIZE/2);
     // Before we can process the first pixel word, the LineBuffer needs to be
@@ -221,7 +231,7 @@ void BilateralFilter(
          Count++) {
         auto InPixelWord = InImg.read(Count);
         LineBuffer.ShiftInPixel(InPixelWord);
-        BilateralProcess<FILTER_SIZE>(InImg, OutImg, LineBuffer, i, j, GI, GS);
+        BilateralProcess<FILTER_SIZE, BORDER>(InImg, OutImg, LineBuffer, i, j, GI, GS);
     }
 
     // 3. Process only (flush out). The input to LineBuffer is 0.
@@ -230,7 +240,7 @@ void BilateralFilter(
     for (unsigned Count = FrameSize;
         Count < FrameSize + LineBufferPixelWordFillCount; Count++) {
         LineBuffer.ShiftInPixel(0);
-        BilateralProcess<FILTER_SIZE>(InImg, OutImg, LineBuffer, i, j, GI, GS);
+        BilateralProcess<FILTER_SIZE, BORDER>(InImg, OutImg, LineBuffer, i, j, GI, GS);
         }
 }
 
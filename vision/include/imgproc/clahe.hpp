@@ -0,0 +1,306 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY
+// IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A
+// PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT,
+// SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE
+// OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF
+// MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.
+// TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL LIABILITY ON ALL
+// CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID
+// DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP OFFERS NO SUPPORT FOR THE
+// SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#pragma once
+
+#include "../common/common.hpp"
+#include "../common/utils.hpp"
+#include <hls/ap_fixpt.hpp>
+#include "../../../math/include/hls_common.hpp"
+
+namespace hls {
+namespace vision {
+
+// round(Num / DEN) for Num <= 255 * DEN, ties rounded up. The division by the
+// constant DEN is a multiply by INV_DEN = ceil(2^SHIFT / DEN) and a shift. With
+// SHIFT = bit_width(Num + DEN / 2) + bit_width(DEN), the error of INV_DEN is
+// less than 1 / DEN, too small to change the result, so it is exact.
+template <uint64_t DEN, unsigned NUM_BITS>
+ap_uint<8> CLAHERoundDiv(ap_uint<NUM_BITS> Num) {
+    const int DEN_BITS = hls::math::bit_width(DEN);
+    const int N_BITS = 8 + DEN_BITS; // Num + DEN / 2 < 256 * DEN
+    const int SHIFT = N_BITS + DEN_BITS;
+    const uint64_t INV_DEN = ((1ull << SHIFT) + DEN - 1) / DEN;
+    ap_uint<N_BITS> N = Num + DEN / 2;
+    ap_uint<N_BITS + SHIFT> Prod = N * ap_uint<SHIFT>(INV_DEN);
+    return Prod >> SHIFT;
+}
+
+/***************************************************************************//**
+ * @brief  Contrast-limited adaptive histogram equalisation (CLAHE) for a
+ *         single-channel, 8-bit video stream.
+ *
+ *         The frame is split into TILES_Y x TILES_X tiles. Each tile gets its
+ *         own histogram, clipped at a limit with the excess spread evenly
+ *         over all bins (as in OpenCV), and its own equalisation LUT. Every
+ *         pixel is bilinearly interpolated between the LUTs of the four
+ *         nearest tile centres.
+ *
+ *         Like `EqualizedHistogramVideo()`, frame N is mapped through the
+ *         tile LUTs of frame N-1 while the tile histograms of frame N are
+ *         collected, so there is a single streaming pass, no frame buffer and
+ *         one pixel word in and out per cycle. The first frame after reset
+ *         is passed through unchanged.
+ *
+ * @tparam TILES_X     Number of tile columns (at least 2), default 8.
+ * @tparam TILES_Y     Number of tile rows (at least 2), default 8.
+ * @tparam PIXEL_T     SmartHLS pixel type (only HLS_8UC1 supported).
+ * @tparam H           Image height  (pixels), divisible by TILES_Y.
+ * @tparam W           Image width   (pixels), divisible by TILES_X.
+ * @tparam STORAGE_TYPE
+ *                     SmartHLS storage enum – can be FIFO or FRAME_BUFFER
+ * @tparam NPPC        Pixels processed per clock – 1, 2, 4 or 8. The tile
+ *                     width must be divisible by NPPC.
+ *
+ * @param[in]  InImg       Source image (frame N).
+ * @param[out] OutImg      Frame N mapped through the tile LUTs of frame N-1.
+ * @param[in]  clip_limit  Contrast limit, relative to a flat histogram, as in
+ *                         cv::createCLAHE(). Each bin is clipped at
+ *                         max(1, clip_limit * tile area / 256) pixels.
+ *
+ * @details
+ * * Each NPPC lane has its own set of tile histograms, with the last-pixel
+ *   re-use trick, so the histogram updates keep II = 1.
+ * * The four tiles around a pixel are always two adjacent tile rows and two
+ *   adjacent tile columns, so one of each is even and one odd. The LUTs are
+ *   stored in four banks by (row parity, column parity), and each bank is
+ *   read once per pixel. Every lane has its own copy of the four banks.
+ * * The LUT values and the interpolation weights are exact fractions, so
+ *   both are computed on integers and rounded exactly with CLAHERoundDiv(),
+ *   a multiply by a constant reciprocal instead of a divider.
+ * * After the frame, the LUTs are rebuilt with two HIST_SIZE-long loops per
+ *   tile (clip, then redistribute and integrate), about
+ *   2 * 256 * TILES_X * TILES_Y cycles, which fits in the vertical blanking
+ *   of common video formats.
+ ******************************************************************************/
+template <
+    int           TILES_X = 8,
+    int           TILES_Y = 8,
+    PixelType     PIXEL_T,
+    unsigned      H,
+    unsigned      W,
+    StorageType   STORAGE_TYPE,
+    NumPixelsPerCycle NPPC
+>
+void CLAHE(
+    Img<PIXEL_T, H, W, STORAGE_TYPE, NPPC> &InImg,
+    Img<PIXEL_T, H, W, STORAGE_TYPE, NPPC> &OutImg,
+    float clip_limit = 40.0f)
+{
+    static_assert(DT<PIXEL_T, NPPC>::NumChannels == 1,
+                  "Supports single-channel images only");
+    static_assert(NPPC <= NPPC_8,     "NPPC must be at most 8");
+    static_assert(DT<PIXEL_T, NPPC>::PerChannelPixelWidth == 8,
+                  "CLAHE is fixed to 8-bit pixels");
+    static_assert(TILES_X >= 2 && TILES_Y >= 2,
+                  "CLAHE needs at least two tiles in each direction");
+    static_assert(H % TILES_Y == 0 && W % TILES_X == 0,
+                  "In CLAHE, the frame size has to be divisible by the number "
+                  "of tiles.");
+    static_assert((W / TILES_X) % NPPC == 0,
+                  "In CLAHE, the tile width has to be divisible by the number "
+                  "of pixels per clock.");
+
+    const int HIST_SIZE = 256;
+    const unsigned TH = H / TILES_Y, TW = W / TILES_X;
+    const unsigned TileArea = TH * TW;
+    const int NUM_TILES = TILES_X * TILES_Y;
+    const int HALF_X = (TILES_X + 1) / 2;
+    const int BANK_TILES = ((TILES_Y + 1) / 2) * HALF_X;
+
+    // The interpolation weights are nx / (2 * TW) and ny / (2 * TH) with
+    // integer nx and ny, so the interpolated value is Num / INTERP_DEN with
+    // an integer Num, and is rounded exactly by CLAHERoundDiv().
+    const uint64_t INTERP_DEN = 4ull * TW * TH;
+    static_assert(4ull * (W / TILES_X) * (H / TILES_Y) < (1ull << 25),
+                  "In CLAHE, the tile area must be less than 2^23 pixels.");
+
+    const unsigned PixelWidth = DT<PIXEL_T, NPPC>::W / NPPC;
+    using PixelWordT = typename DT<PIXEL_T, NPPC>::T;
+    using PixelT = ap_uint<PixelWidth>;
+    using CountT = ap_uint<hls::math::bit_width(TileArea)>;
+    // Weight numerators, in [0, 2 * TW] and [0, 2 * TH].
+    using WeightXT = ap_uint<hls::math::bit_width(2 * TW)>;
+    using WeightYT = ap_uint<hls::math::bit_width(2 * TH)>;
+    using InterpXT = ap_uint<8 + hls::math::bit_width(2 * TW)>;
+    using NumT = ap_uint<8 + hls::math::bit_width(INTERP_DEN)>;
+
+    OutImg.set_height(InImg.get_height());
+    OutImg.set_width(InImg.get_width());
+
+    static CountT hist[NPPC][NUM_TILES * HIST_SIZE];
+    #pragma HLS memory partition variable(hist) type(complete) dim(1)
+    // Bank (row parity) * 2 + (column parity) of lane k is lut[k * 4 + bank].
+    static PixelT lut[NPPC * 4][BANK_TILES * HIST_SIZE];
+    #pragma HLS memory partition variable(lut) type(complete) dim(1)
+    static bool lut_valid = false;
+
+    unsigned PrevAddr[NPPC];
+    CountT   PrevVal[NPPC];
+    #pragma HLS loop unroll
+    for (int k = 0; k < NPPC; k++) {
+        PrevAddr[k] = 0;
+        PrevVal[k] = 0;
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* 1.  Map frame N through the tile LUTs of frame N-1 while building  */
+    /*     the tile histograms of frame N                                 */
+    /* ------------------------------------------------------------------ */
+    unsigned x = 0, tx = 0, rx = 0;   // column, tile column, column in tile
+    unsigned ty = 0, ry = 0;          // tile row, row in tile
+
+HLS_CLAHE_STREAM:
+    #pragma HLS loop pipeline
+    #pragma HLS loop dependence variable(hist) type(inter) direction(RAW) dependent(false)
+    for (int p = 0; p < H * W / NPPC; p++) {
+        PixelWordT InWord = InImg.read(p);
+        PixelWordT OutWord;
+
+        // Upper tile row ty1 and the weight ny / (2 * TH) of row ty1 + 1.
+        // Pixels above the first or below the last tile centre use a single
+        // tile row.
+        int ty1;
+        unsigned ny;
+        if (2 * ry < TH) { ty1 = (int)ty - 1; ny = 2 * ry + TH; }
+        else             { ty1 = ty;          ny = 2 * ry - TH; }
+        if (ty1 < 0)            { ty1 = 0;           ny = 0; }
+        if (ty1 > TILES_Y - 2)  { ty1 = TILES_Y - 2; ny = 2 * TH; }
+        WeightYT ya = ny, ya1 = 2 * TH - ny;
+
+        #pragma HLS loop unroll
+        for (int k = 0; k < NPPC; k++) {
+            PixelT curPix = InWord.byte(k, PixelWidth);
+
+            // Same for the left tile column tx1 and the weight nx / (2 * TW).
+            unsigned rxk = rx + k;
+            int tx1;
+            unsigned nx;
+            if (2 * rxk < TW) { tx1 = (int)tx - 1; nx = 2 * rxk + TW; }
+            else              { tx1 = tx;          nx = 2 * rxk - TW; }
+            if (tx1 < 0)            { tx1 = 0;           nx = 0; }
+            if (tx1 > TILES_X - 2)  { tx1 = TILES_X - 2; nx = 2 * TW; }
+            WeightXT xa = nx, xa1 = 2 * TW - nx;
+
+            // One read from each parity bank: L[dy][dx] is the LUT value of
+            // tile (ty1 + dy, tx1 + dx).
+            PixelT L[2][2];
+            #pragma HLS loop unroll
+            for (int py = 0; py < 2; py++) {
+                #pragma HLS loop unroll
+                for (int px = 0; px < 2; px++) {
+                    int dy = ((ty1 & 1) != py), dx = ((tx1 & 1) != px);
+                    int a = ty1 + dy, b = tx1 + dx;
+                    L[dy][dx] = lut[k * 4 + py * 2 + px]
+                                   [((a >> 1) * HALF_X + (b >> 1)) * HIST_SIZE + curPix];
+                }
+            }
+            InterpXT top = InterpXT(L[0][0]) * xa1 + InterpXT(L[0][1]) * xa;
+            InterpXT bot = InterpXT(L[1][0]) * xa1 + InterpXT(L[1][1]) * xa;
+            NumT num = NumT(top) * ya1 + NumT(bot) * ya;
+            PixelT res = CLAHERoundDiv<INTERP_DEN>(num);
+            OutWord.byte(k, PixelWidth) = lut_valid ? res : curPix;
+
+            unsigned addr = (ty * TILES_X + tx) * HIST_SIZE + curPix;
+            CountT curVal = hist[k][addr];
+            if (addr == PrevAddr[k])
+                curVal = PrevVal[k];
+            curVal++;
+            hist[k][addr] = curVal;
+            PrevAddr[k] = addr;
+            PrevVal[k] = curVal;
+        }
+        OutImg.write(OutWord, p);
+
+        x += NPPC;
+        rx += NPPC;
+        if (rx == TW) { rx = 0; tx++; }
+        if (x == W) {
+            x = 0; tx = 0; rx = 0;
+            ry++;
+            if (ry == TH) { ry = 0; ty++; }
+        }
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* 2.  Clip each tile histogram and build its LUT                     */
+    /* ------------------------------------------------------------------ */
+    uint32_t Clip = (uint32_t)(clip_limit * TileArea / HIST_SIZE);
+    if (Clip < 1)
+        Clip = 1;
+    // LUT = round(CDF * (HIST_SIZE - 1) / TileArea), rounded exactly.
+    CountT clipped[HIST_SIZE];
+
+HLS_CLAHE_TILES:
+    for (int t = 0; t < NUM_TILES; t++) {
+        uint32_t excess = 0;
+
+    HLS_CLAHE_CLIP:
+        #pragma HLS loop pipeline II(1)
+        for (int i = 0; i < HIST_SIZE; i++) {
+            CountT count = 0;
+            #pragma HLS loop unroll
+            for (int k = 0; k < NPPC; k++) {
+                count += hist[k][t * HIST_SIZE + i];
+                hist[k][t * HIST_SIZE + i] = 0;
+            }
+            if (count > Clip) {
+                excess += count - Clip;
+                count = Clip;
+            }
+            clipped[i] = count;
+        }
+
+        // Spread the excess evenly; the remainder goes one pixel each to
+        // every residual_step-th bin, from bin 0.
+        uint32_t batch = excess / HIST_SIZE;
+        uint32_t residual = excess % HIST_SIZE;
+        uint32_t residual_step = residual ? HIST_SIZE / residual : HIST_SIZE;
+        if (residual_step < 1)
+            residual_step = 1;
+        uint32_t next_bonus = 0;
+
+        const int a = t / TILES_X, b = t % TILES_X;
+        const int bank = (a & 1) * 2 + (b & 1);
+        const int base = ((a >> 1) * HALF_X + (b >> 1)) * HIST_SIZE;
+        uint32_t cdf = 0;
+
+    HLS_CLAHE_LUT:
+        #pragma HLS loop pipeline II(1)
+        for (int i = 0; i < HIST_SIZE; i++) {
+            uint32_t count = clipped[i] + batch;
+            if (residual > 0 && i == next_bonus) {
+                count++;
+                residual--;
+                next_bonus += residual_step;
+            }
+            cdf += count;
+            ap_uint<8 + hls::math::bit_width(TileArea)> num = cdf * (HIST_SIZE - 1);
+            PixelT g = CLAHERoundDiv<TileArea>(num);
+            #pragma HLS loop unroll
+            for (int k = 0; k < NPPC; k++)
+                lut[k * 4 + bank][base + i] = g;
+        }
+    }
+    lut_valid = true;
+}
+
+} // End of namespace vision.
+} // End of namespace hls.
@@ -30,6 +30,8 @@ namespace vision {
 
 
 //------------------------------------------------------------------------------
+// Kernel coefficients are integers in units of 1/256, i.e. the convolution sum
+// is divided by 256 and rounded.
 template <int SIZE, int W>
 struct ConvolutionKernel {
     using TmpPixelT = ap_int<W>;
@@ -43,33 +45,138 @@ struct ConvolutionKernel {
             }
         }
     }
+    // Runtime coefficients, e.g. from an AXI target array.
+    ConvolutionKernel(const int Coeffs[SIZE][SIZE]) {
+        for (int i=0; i< SIZE; i++) {
+            for (int j=0; j<SIZE; j++){
+                matrix[i][j]=Coeffs[i][j];
+            }
+        }
+    }
     int getElement(int i, int j) const {
         return matrix[i][j];
     }
 };
 
+//------------------------------------------------------------------------------
+// Separable kernel: element (i, j) of the 2D kernel is y[i] * x[j]. The
+// product is in units of 1/256, e.g. x = y = {1, 4, 6, 4, 1} is the 5x5
+// Gaussian kernel.
+template <int SIZE>
+struct SeparableConvolutionKernel {
+    int x[SIZE];
+    int y[SIZE];
+
+    template<typename FuncX, typename FuncY>
+    SeparableConvolutionKernel(FuncX FunctorX, FuncY FunctorY) {
+        for (int i=0; i< SIZE; i++) {
+            x[i]=FunctorX(i);
+            y[i]=FunctorY(i);
+        }
+    }
+    SeparableConvolutionKernel(const int CoeffsX[SIZE], const int CoeffsY[SIZE]) {
+        for (int i=0; i< SIZE; i++) {
+            x[i]=CoeffsX[i];
+            y[i]=CoeffsY[i];
+        }
+    }
+    int getX(int j) const { return x[j]; }
+    int getY(int i) const { return y[i]; }
+};
+
+// The 2D convolution keeps no state between pixel words. The separable one
+// keeps the vertical (column) sums of the window in a LineBufferColumnCache.
+struct ConvolutionNoState {};
+
+//------------------------------------------------------------------------------
+// Rounds a sum of coefficient * pixel products (coefficients in 1/256) and
+// clamps it to an 8-bit channel.
+template <typename TmpPixelT>
+TmpPixelT ConvolutionRound(TmpPixelT Sum) {
+    const unsigned DIVISOR = 256;
+    // Note: `(a+128)/256` has the same effect as `a/256+0.5`, which is
+    // essentially to round the number.
+    Sum = (Sum + TmpPixelT(DIVISOR / 2)) / TmpPixelT(DIVISOR);
+    // TODO T: Need to figure out how to do clamp the value e.g., to support
+    // signed vs. unsigned, what's the min and max value to clamp.
+    // Assume [0, 255] for now.
+    // const TmpPixelT OutMaxPixelVal = (TmpPixelT(1) << OutPixelWidth) - 1;
+    const TmpPixelT OutMaxPixelVal = TmpPixelT(255);
+    Sum = (Sum > OutMaxPixelVal) ? OutMaxPixelVal : Sum;
+    Sum = (Sum < TmpPixelT(0)) ? TmpPixelT(0) : Sum;
+    return Sum;
+}
+
+//------------------------------------------------------------------------------
+// Called for every pixel word shifted into the LineBuffer, including the fill
+// phase. Nothing to do for the 2D convolution.
+template <unsigned KERNEL_SIZE, BorderType BORDER, unsigned PIXEL_WIDTH,
+          typename LineBufferT, typename KernelT>
+void ConvolutionShiftColumns(LineBufferT &LineBuffer, unsigned ImgHeight,
+                             unsigned ImgWords, const KernelT &KERNEL,
+                             ConvolutionNoState &State,
+                             ap_uint<PIXEL_WIDTH> BorderValue) {}
+
+// Shifts the column sums along with the window, and computes the vertical sums
+// of the newest column of pixel words (KERNEL_SIZE multiplies per channel and
+// pixel). Rows outside the image are padded according to BORDER.
+template <unsigned KERNEL_SIZE, BorderType BORDER, unsigned PIXEL_WIDTH,
+          typename LineBufferT, unsigned NPPC, unsigned CHANNELS, typename T>
+void ConvolutionShiftColumns(
+    LineBufferT &LineBuffer, unsigned ImgHeight, unsigned ImgWords,
+    const SeparableConvolutionKernel<KERNEL_SIZE> &KERNEL,
+    sev::LineBufferColumnCache<KERNEL_SIZE, NPPC, CHANNELS, T> &State,
+    ap_uint<PIXEL_WIDTH> BorderValue) {
+    const unsigned ChannelWidth = 8;
+    const ap_uint<PIXEL_WIDTH> Padding =
+        (BORDER == BORDER_CONSTANT) ? BorderValue : ap_uint<PIXEL_WIDTH>(0);
+
+    // Rows of the window that the rows of the newest column are padded with.
+    unsigned SrcY[KERNEL_SIZE];
+    bool ValidY[KERNEL_SIZE];
+    LineBuffer.template BorderSources<BORDER>(State.Row, ImgHeight, SrcY,
+                                              ValidY);
+
+    State.ShiftColumns();
+
+    for (int k = 0; k < NPPC; k++) {
+        for (int c = 0; c < CHANNELS; c++) {
+            T Sum = 0;
+            for (int d = 0; d < KERNEL_SIZE; d++) {
+                ap_uint<PIXEL_WIDTH> Pixel =
+                    ValidY[d] ? ap_uint<PIXEL_WIDTH>(
+                                    LineBuffer.window[SrcY[d]][KERNEL_SIZE - 1]
+                                        .byte(k, PIXEL_WIDTH))
+                              : Padding;
+                T Channel = Pixel.byte(c, ChannelWidth);
+                Sum += Channel * KERNEL.getY(d);
+            }
+            State.Column[KERNEL_SIZE - 1][k][c] = Sum;
+        }
+    }
+    State.NextWord(ImgWords);
+}
+
 //------------------------------------------------------------------------------
 template <
     unsigned KERNEL_SIZE, 
+    BorderType BORDER,
     PixelType PIXEL_T_IN, 
     PixelType PIXEL_T_OUT,
     unsigned H, 
     unsigned W, 
     StorageType STORAGE_IN,
-    StorageType STORAGE_OUT, NumPixelsPerCycle NPPC
+    StorageType STORAGE_OUT, NumPixelsPerCycle NPPC,
+    typename LineBufferT
 > void ConvolutionProcess (
     vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
     vision::Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg,
-    LineBuffer<
-        typename DT<PIXEL_T_IN, NPPC>::T,
-        W / NPPC, 
-        KERNEL_SIZE,
-        DT<PIXEL_T_IN, NPPC>::W / NPPC, 
-        unsigned(NPPC)
-    > &LineBuffer,
+    LineBufferT &LineBuffer,
     unsigned &i,
     unsigned &j,
-    const ConvolutionKernel<KERNEL_SIZE,8> &KERNEL
+    const ConvolutionKernel<KERNEL_SIZE,8> &KERNEL,
+    ConvolutionNoState &State,
+    ap_uint<DT<PIXEL_T_IN, NPPC>::W / NPPC> BorderValue
 ) {
     using OutPixelWordT = typename DT<PIXEL_T_OUT, NPPC>::T;
 
@@ -77,64 +184,45 @@ template <
     // a slightly larger width than max(InPixelWidth, OutPixelWidth)
     const unsigned InPixelWidth = DT<PIXEL_T_IN, NPPC>::W / NPPC,
                    OutPixelWidth = DT<PIXEL_T_OUT, NPPC>::W / NPPC;
-    const unsigned TmpPixelWidth = InPixelWidth + 9;
+    const unsigned ChannelWidth = DT<PIXEL_T_IN, NPPC>::PerChannelPixelWidth,
+                   OutChannelWidth = DT<PIXEL_T_OUT, NPPC>::PerChannelPixelWidth;
+    const unsigned NumChannels = DT<PIXEL_T_IN, NPPC>::NumChannels;
+    const unsigned TmpPixelWidth = ChannelWidth + 9;
     using TmpPixelT = ap_int<TmpPixelWidth>;
 
     const unsigned ImgHeight = InImg.get_height(), ImgWidth = InImg.get_width();
     const unsigned ImgIdx = i * (ImgWidth / NPPC) + j;
-    const unsigned DIVISOR = 256;
 
     OutPixelWordT OutPixelWord;
 
     // Now do the convolution at the current point:
-    const int KernelRadius = KERNEL_SIZE / (KERNEL_SIZE/2);
+    const int KernelRadius = KERNEL_SIZE / 2;
     for (int k = 0; k < NPPC; k++) {
-        // Initialize the input window from LineBuffer.window. If the coordinate
-        // is out-of-bound, set the value to 0 (i.e., zero-padding).
-        TmpPixelT Window[KERNEL_SIZE][KERNEL_SIZE];
-        for (int OffsetY = -KernelRadius; OffsetY <= KernelRadius; OffsetY++) {
-            for (int OffsetX = -KernelRadius; OffsetX <= KernelRadius;
-                 OffsetX++) {
-                int y = i + OffsetY, x = j * NPPC + k + OffsetX;
-                bool WindowOutOfBounds =
-                    (y < 0) | (y >= ImgHeight) | (x < 0) | (x >= ImgWidth);
-                // Array indices start from 0 so we need to "recalibrate" the
-                // index by adding `KernelRadius`. E.g. for 5x5 kernel, the
-                // offset is from -2 to 2. To turn it into 0-based index, we
-                // need to add KernelRadius = 2.
-                int ArrayIdxY = OffsetY + KernelRadius,
-                    ArrayIdxX = OffsetX + KernelRadius;
-                Window[ArrayIdxY][ArrayIdxX] =
-                    WindowOutOfBounds ? TmpPixelT(0)
-                                      : TmpPixelT(LineBuffer.AccessWindow(
-                                            ArrayIdxY, ArrayIdxX, k));
-            }
-        }
+        // Get the input window from LineBuffer, padded according to BORDER
+        // where it extends outside of the image.
+        ap_uint<InPixelWidth> Window[KERNEL_SIZE][KERNEL_SIZE];
+        LineBuffer.template GetWindow<BORDER>(Window, i, j, k, ImgHeight,
+                                              ImgWidth, BorderValue);
 
-        // Apply the convolution.
-        TmpPixelT Sum = 0;
-        for (int OffsetY = -KernelRadius; OffsetY <= KernelRadius; OffsetY++) {
-            for (int OffsetX = -KernelRadius; OffsetX <= KernelRadius;
-                 OffsetX++) {
-                // "Recalibrate" the array index to be 0-based.
-                int ArrayIdxY = OffsetY + KernelRadius,
-                    ArrayIdxX = OffsetX + KernelRadius;
-                // Get the pixel in "receptive field" from LineBuffer's window.
-                auto Pixel = Window[ArrayIdxY][ArrayIdxX];
-                Sum += Pixel * KERNEL.getElement(ArrayIdxY, ArrayIdxX);
+        // Apply the convolution to every channel.
+        ap_uint<OutPixelWidth> OutPixel;
+        for (int c = 0; c < NumChannels; c++) {
+            TmpPixelT Sum = 0;
+            for (int OffsetY = -KernelRadius; OffsetY <= KernelRadius; OffsetY++) {
+                for (int OffsetX = -KernelRadius; OffsetX <= KernelRadius;
+                     OffsetX++) {
+                    // "Recalibrate" the array index to be 0-based.
+                    int ArrayIdxY = OffsetY + KernelRadius,
+                        ArrayIdxX = OffsetX + KernelRadius;
+                    // Get the pixel in "receptive field" from LineBuffer's window.
+                    auto Pixel = TmpPixelT(
+                        Window[ArrayIdxY][ArrayIdxX].byte(c, ChannelWidth));
+                    Sum += Pixel * KERNEL.getElement(ArrayIdxY, ArrayIdxX);
+                }
             }
+            OutPixel.byte(c, OutChannelWidth) = ConvolutionRound(Sum);
         }
-
-        // Note: `(a+128)/256` has the same effect as `a/256+0.5`, which is
-        // essentially to round the number.
-        Sum = (Sum + TmpPixelT(DIVISOR / 2)) / TmpPixelT(DIVISOR);
-        // TODO T: Need to figure out how to do clamp the value e.g., to support
-        // signed vs. unsigned, what's the min and max value to clamp.
-        // Assume [0, 255] for now.
-        // const TmpPixelT OutMaxPixelVal = (TmpPixelT(1) << OutPixelWidth) - 1;
-        const TmpPixelT OutMaxPixelVal = TmpPixelT(255);
-        Sum = (Sum > OutMaxPixelVal) ? OutMaxPixelVal : Sum;
-        OutPixelWord.byte(k, OutPixelWidth) = Sum;
+        OutPixelWord.byte(k, OutPixelWidth) = OutPixel;
     }
 
     // Now write to OutImg.
@@ -149,46 +237,100 @@ template <
 }
 
 //------------------------------------------------------------------------------
-// TODO T:
-// - Add support for multiple channels.
-// - Add support for clamp logic. Right now we assume [0, 255] for all pixel
-//   types which is not correct, but we need to be really careful with the clamp
-//   logic.
+// Separable version: the horizontal pass over the column sums kept in State,
+// KERNEL_SIZE multiplies per channel and pixel.
 template <
     unsigned KERNEL_SIZE, 
-    PixelType PIXEL_T_IN,
+    BorderType BORDER,
+    PixelType PIXEL_T_IN, 
     PixelType PIXEL_T_OUT,
     unsigned H, 
     unsigned W, 
-    StorageType STORAGE_IN = StorageType::FIFO,
-    StorageType STORAGE_OUT = StorageType::FIFO,
-    NumPixelsPerCycle NPPC = NPPC_1,
-    typename Func
-> void Convolution_2d(
+    StorageType STORAGE_IN,
+    StorageType STORAGE_OUT, NumPixelsPerCycle NPPC,
+    typename LineBufferT, unsigned STATE_NPPC, unsigned CHANNELS, typename T
+> void ConvolutionProcess (
     vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
     vision::Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg,
-    Func Functor
+    LineBufferT &LineBuffer,
+    unsigned &i,
+    unsigned &j,
+    const SeparableConvolutionKernel<KERNEL_SIZE> &KERNEL,
+    sev::LineBufferColumnCache<KERNEL_SIZE, STATE_NPPC, CHANNELS, T> &State,
+    ap_uint<DT<PIXEL_T_IN, NPPC>::W / NPPC> BorderValue
 ) {
-    #pragma HLS memory partition argument(InImg) type(struct_fields)
-    #pragma HLS memory partition argument(OutImg) type(struct_fields)
+    using OutPixelWordT = typename DT<PIXEL_T_OUT, NPPC>::T;
+    const unsigned OutPixelWidth = DT<PIXEL_T_OUT, NPPC>::W / NPPC;
+    const unsigned OutChannelWidth = DT<PIXEL_T_OUT, NPPC>::PerChannelPixelWidth;
 
-    static_assert(KERNEL_SIZE == 3 | KERNEL_SIZE == 5 | KERNEL_SIZE == 7,
-        "Convolution_2d: KERNEL_SIZE must be either 3, 5 or 7.");
+    const unsigned ImgWidth = InImg.get_width();
+    const unsigned ImgIdx = i * (ImgWidth / NPPC) + j;
 
-    static_assert(DT<PIXEL_T_IN, NPPC>::PerChannelPixelWidth == 8, 
-        "Convolution_2d: Channel width must be 8.");
+    OutPixelWordT OutPixelWord;
 
-    static_assert(DT<PIXEL_T_IN, NPPC>::NumChannels == 1 && 
-        DT<PIXEL_T_OUT, NPPC>::NumChannels == 1,
-        "Convolution_2D only supports 1-channel images.");
+    // Columns outside of the image are padded with the column sum of
+    // BorderValue (BORDER_CONSTANT only).
+    using InPixelT = ap_uint<DT<PIXEL_T_IN, NPPC>::W / NPPC>;
+    const InPixelT Padding =
+        (BORDER == BORDER_CONSTANT) ? BorderValue : InPixelT(0);
+    int SumY = 0;
+    for (int d = 0; d < KERNEL_SIZE; d++)
+        SumY += KERNEL.getY(d);
+    for (int k = 0; k < NPPC; k++) {
+        // Pixel columns of the window that the columns around pixel k are
+        // padded with.
+        unsigned SrcX[KERNEL_SIZE];
+        bool ValidX[KERNEL_SIZE];
+        LineBuffer.template BorderPixelColumns<BORDER>(j, k, ImgWidth, SrcX,
+                                                       ValidX);
 
-    static_assert(W % NPPC == 0,
-        "In Convolution_2D, the width of the frame has to be divisible "
-        "by the number of pixels per clock.");
+        ap_uint<OutPixelWidth> OutPixel;
+        for (int c = 0; c < CHANNELS; c++) {
+            T Sum = 0;
+            T BorderColSum = T(Padding.byte(c, 8)) * SumY;
+            for (int d = 0; d < KERNEL_SIZE; d++) {
+                T ColSum = ValidX[d]
+                    ? State.Column[SrcX[d] / NPPC][SrcX[d] % NPPC][c]
+                    : BorderColSum;
+                Sum += ColSum * KERNEL.getX(d);
+            }
+            OutPixel.byte(c, OutChannelWidth) = ConvolutionRound(Sum);
+        }
+        OutPixelWord.byte(k, OutPixelWidth) = OutPixel;
+    }
 
-    #pragma HLS memory replicate_rom variable(KERNEL.matrix) max_replicas(0)
-    static const ConvolutionKernel<KERNEL_SIZE, 8> KERNEL(Functor);
-    
+    OutImg.write(OutPixelWord, ImgIdx);
+    if (j < (W/NPPC) - 1) {
+        j++;
+    } else {
+        i++;
+        j = 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Streams the image through the LineBuffer and calls ConvolutionProcess() for
+// every output pixel word. Shared by all the Convolution_2d variants.
+template <
+    unsigned KERNEL_SIZE, 
+    BorderType BORDER,
+    LineBufferStorage LB_STORAGE,
+    PixelType PIXEL_T_IN,
+    PixelType PIXEL_T_OUT,
+    unsigned H, 
+    unsigned W, 
+    StorageType STORAGE_IN,
+    StorageType STORAGE_OUT,
+    NumPixelsPerCycle NPPC,
+    typename KernelT,
+    typename StateT
+> void ConvolutionStream(
+    vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg,
+    const KernelT &KERNEL,
+    StateT &State,
+    ap_uint<DT<PIXEL_T_IN, NPPC>::W / NPPC> BorderValue
+) {
     using InPixelWordT = typename DT<PIXEL_T_IN, NPPC>::T;
 
     const unsigned ImgHeight = InImg.get_height(), ImgWidth = InImg.get_width();
@@ -197,50 +339,27 @@ template <
 
     const unsigned FrameSize = (ImgHeight * ImgWidth) / NPPC;
     const unsigned InPixelWidth = DT<PIXEL_T_IN, NPPC>::W / NPPC;
-    LineBuffer<InPixelWordT, W / NPPC, KERNEL_SIZE, InPixelWidth, NPPC>
+    LineBufferWithStorage<InPixelWordT, W / NPPC, KERNEL_SIZE, InPixelWidth,
+                          NPPC, LB_STORAGE>
         LineBuffer;
-    const unsigned KernelRadius = KERNEL_SIZE / (KERNEL_SIZE/2);
+    const unsigned KernelRadius = KERNEL_SIZE / 2;
     // Before we can process the first pixel word, the LineBuffer needs to be
-    // filled for a certain number of pixels first. This number of pixels
-    // (denoted `LineBufferPixelFillCount`) is:
-    //   `KernelRadius` rows, plus `NPPC + KernelRadius - 1` pixels of the next
-    //   row.
-    // It's best to draw a picture to see why this is the case. The intuition is
-    // that, processing the first pixel word is equivalent to processing the
-    // first NPPC pixels. So we need to have enough pixels in the LineBuffer to
-    // be able to construct a windows of size `KernelRadius` at the NPPC-th
-    // pixel of the first pixel word.
-    // Some examples:
-    // +-------------+-------------------+------+--------------------------+
-    // | KERNEL_SIZE | KernelRadius      | NPPC | LineBufferPixelFillCount |
-    // |             | = KERNEL_SIZE / 2 |      |                          |
-    // +-------------+-------------------+------+--------------------------+
-    // | 3           | 1                 | 1    | 1 row  + 1 pixel         |
-    // | 3           | 1                 | 4    | 1 row  + 4 pixels        |
-    // | 5           | 2                 | 1    | 2 rows + 2 pixels        |
-    // | 5           | 2                 | 4    | 2 rows + 5 pixels        |
-    // +-------------+-------------------+------+--------------------------+
-    //
-    // We have:
-    //   LineBufferPixelFillCount
-    // = KernelRadius * ImgWidth + NPPC + KernelRadius - 1
-    // = KernelRadius * (ImgWidth + 1) + NPPC - 1
-    //
-    //   LineBufferPixelWordFillCount = ceil(LineBufferPixelFillCount / NPPC)
-    const unsigned LineBufferPixelFillCount =
-        KernelRadius * (ImgWidth + 1) + NPPC - 1;
-    unsigned LineBufferPixelWordFillCount = LineBufferPixelFillCount / NPPC;
-    // Note that C++ unsigned division rounds down, so we can do this to
-    // implement ceil():
-    if (LineBufferPixelFillCount % NPPC != 0) {
-        LineBufferPixelWordFillCount += 1;
-    }
+    // filled for a certain number of pixel words first. The window of the
+    // LineBuffer is centred on its word `KernelRadius` (see
+    // LineBuffer::AccessWindow()), so the input has to be `KernelRadius` rows
+    // plus `KernelRadius` pixel words ahead of the output:
+    //   LineBufferPixelWordFillCount = KernelRadius * (ImgWidth / NPPC + 1)
+    // With NPPC = 1 this is `KernelRadius` rows plus `KernelRadius` pixels.
+    const unsigned LineBufferPixelWordFillCount =
+        KernelRadius * (ImgWidth / NPPC + 1);
 
     // 1. Fill LineBuffer only
     #pragma HLS loop pipeline
     for (unsigned Count = 0; Count < LineBufferPixelWordFillCount; Count++) {
         auto InPixelWord = InImg.read(Count);
         LineBuffer.ShiftInPixel(InPixelWord);
+        ConvolutionShiftColumns<KERNEL_SIZE, BORDER>(
+            LineBuffer, ImgHeight, ImgWidth / NPPC, KERNEL, State, BorderValue);
     }
 
     // 2. Fill LineBuffer and process (steady state)
@@ -252,7 +371,10 @@ template <
          Count++) {
         auto InPixelWord = InImg.read(Count);
         LineBuffer.ShiftInPixel(InPixelWord);
-        ConvolutionProcess<KERNEL_SIZE>(InImg, OutImg, LineBuffer, i, j, KERNEL);
+        ConvolutionShiftColumns<KERNEL_SIZE, BORDER>(
+            LineBuffer, ImgHeight, ImgWidth / NPPC, KERNEL, State, BorderValue);
+        ConvolutionProcess<KERNEL_SIZE, BORDER>(InImg, OutImg, LineBuffer, i, j,
+                                               KERNEL, State, BorderValue);
     }
 
     // 3. Process only (flush out). The input to LineBuffer is 0.
@@ -260,10 +382,182 @@ template <
     for (unsigned Count = FrameSize;
          Count < FrameSize + LineBufferPixelWordFillCount; Count++) {
         LineBuffer.ShiftInPixel(0);
-        ConvolutionProcess<KERNEL_SIZE>(InImg, OutImg, LineBuffer, i, j, KERNEL);
+        ConvolutionShiftColumns<KERNEL_SIZE, BORDER>(
+            LineBuffer, ImgHeight, ImgWidth / NPPC, KERNEL, State, BorderValue);
+        ConvolutionProcess<KERNEL_SIZE, BORDER>(InImg, OutImg, LineBuffer, i, j,
+                                               KERNEL, State, BorderValue);
     }
 }
 
+//------------------------------------------------------------------------------
+// Checks shared by all the Convolution_2d variants.
+template <unsigned KERNEL_SIZE, PixelType PIXEL_T_IN, PixelType PIXEL_T_OUT,
+          unsigned W, NumPixelsPerCycle NPPC>
+void ConvolutionStaticChecks() {
+    static_assert(KERNEL_SIZE == 3 | KERNEL_SIZE == 5 | KERNEL_SIZE == 7,
+        "Convolution_2d: KERNEL_SIZE must be either 3, 5 or 7.");
+
+    static_assert(DT<PIXEL_T_IN, NPPC>::PerChannelPixelWidth == 8 &&
+        DT<PIXEL_T_OUT, NPPC>::PerChannelPixelWidth == 8,
+        "Convolution_2d: Channel width must be 8.");
+
+    static_assert(DT<PIXEL_T_IN, NPPC>::NumChannels ==
+        DT<PIXEL_T_OUT, NPPC>::NumChannels,
+        "Convolution_2D: input and output must have the same number of channels.");
+
+    static_assert(W % NPPC == 0,
+        "In Convolution_2D, the width of the frame has to be divisible "
+        "by the number of pixels per clock.");
+}
+
+//------------------------------------------------------------------------------
+// The pixels outside of the image are padded according to BORDER (see
+// BorderType), BorderValue is the padding of BORDER_CONSTANT. LB_STORAGE
+// selects how the LineBuffer stores the previous rows (see LineBufferStorage).
+// TODO T:
+// - Add support for clamp logic. Right now we assume [0, 255] for all pixel
+//   types which is not correct, but we need to be really careful with the clamp
+//   logic.
+template <
+    unsigned KERNEL_SIZE, 
+    BorderType BORDER = BORDER_ZERO,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T_IN,
+    PixelType PIXEL_T_OUT,
+    unsigned H, 
+    unsigned W, 
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1,
+    typename Func
+> void Convolution_2d(
+    vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg,
+    Func Functor,
+    ap_uint<DT<PIXEL_T_IN, NPPC>::W / NPPC> BorderValue = 0
+) {
+    #pragma HLS memory partition argument(InImg) type(struct_fields)
+    #pragma HLS memory partition argument(OutImg) type(struct_fields)
+
+    ConvolutionStaticChecks<KERNEL_SIZE, PIXEL_T_IN, PIXEL_T_OUT, W, NPPC>();
+
+    #pragma HLS memory replicate_rom variable(KERNEL.matrix) max_replicas(0)
+    static const ConvolutionKernel<KERNEL_SIZE, 8> KERNEL(Functor);
+    ConvolutionNoState State;
+    ConvolutionStream<KERNEL_SIZE, BORDER, LB_STORAGE>(InImg, OutImg, KERNEL,
+                                                      State, BorderValue);
+}
+
+//------------------------------------------------------------------------------
+// Same as above, with the coefficients given at runtime. The array is copied
+// into registers once per frame, so it can be an AXI target argument of the
+// top-level function and be changed between frames without resynthesis.
+template <
+    unsigned KERNEL_SIZE, 
+    BorderType BORDER = BORDER_ZERO,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T_IN,
+    PixelType PIXEL_T_OUT,
+    unsigned H, 
+    unsigned W, 
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1
+> void Convolution_2d_Runtime(
+    vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg,
+    const int Coeffs[KERNEL_SIZE][KERNEL_SIZE],
+    ap_uint<DT<PIXEL_T_IN, NPPC>::W / NPPC> BorderValue = 0
+) {
+    #pragma HLS memory partition argument(InImg) type(struct_fields)
+    #pragma HLS memory partition argument(OutImg) type(struct_fields)
+
+    ConvolutionStaticChecks<KERNEL_SIZE, PIXEL_T_IN, PIXEL_T_OUT, W, NPPC>();
+
+    #pragma HLS memory partition variable(KERNEL) type(complete)
+    const ConvolutionKernel<KERNEL_SIZE, 8> KERNEL(Coeffs);
+    ConvolutionNoState State;
+    ConvolutionStream<KERNEL_SIZE, BORDER, LB_STORAGE>(InImg, OutImg, KERNEL,
+                                                      State, BorderValue);
+}
+
+//------------------------------------------------------------------------------
+// Separable convolution: the kernel is y[i] * x[j], with FunctorX(j) and
+// FunctorY(i) known at compile time. Each pixel costs KERNEL_SIZE multiplies
+// for the vertical pass plus KERNEL_SIZE for the horizontal pass, instead of
+// KERNEL_SIZE * KERNEL_SIZE.
+template <
+    unsigned KERNEL_SIZE, 
+    BorderType BORDER = BORDER_ZERO,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T_IN,
+    PixelType PIXEL_T_OUT,
+    unsigned H, 
+    unsigned W, 
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1,
+    typename FuncX,
+    typename FuncY
+> void SeparableConvolution_2d(
+    vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg,
+    FuncX FunctorX,
+    FuncY FunctorY,
+    ap_uint<DT<PIXEL_T_IN, NPPC>::W / NPPC> BorderValue = 0
+) {
+    #pragma HLS memory partition argument(InImg) type(struct_fields)
+    #pragma HLS memory partition argument(OutImg) type(struct_fields)
+
+    ConvolutionStaticChecks<KERNEL_SIZE, PIXEL_T_IN, PIXEL_T_OUT, W, NPPC>();
+
+    #pragma HLS memory replicate_rom variable(KERNEL.x) max_replicas(0)
+    #pragma HLS memory replicate_rom variable(KERNEL.y) max_replicas(0)
+    static const SeparableConvolutionKernel<KERNEL_SIZE> KERNEL(FunctorX, FunctorY);
+    sev::LineBufferColumnCache<KERNEL_SIZE, NPPC,
+        DT<PIXEL_T_IN, NPPC>::NumChannels, ap_int<8 + 9>> State;
+    #pragma HLS memory partition variable(State) type(complete)
+    State.Reset();
+    ConvolutionStream<KERNEL_SIZE, BORDER, LB_STORAGE>(InImg, OutImg, KERNEL,
+                                                      State, BorderValue);
+}
+
+//------------------------------------------------------------------------------
+// Separable convolution with runtime coefficients, e.g. from AXI target
+// arrays of the top-level function.
+template <
+    unsigned KERNEL_SIZE, 
+    BorderType BORDER = BORDER_ZERO,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T_IN,
+    PixelType PIXEL_T_OUT,
+    unsigned H, 
+    unsigned W, 
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1
+> void SeparableConvolution_2d_Runtime(
+    vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg,
+    const int CoeffsX[KERNEL_SIZE],
+    const int CoeffsY[KERNEL_SIZE],
+    ap_uint<DT<PIXEL_T_IN, NPPC>::W / NPPC> BorderValue = 0
+) {
+    #pragma HLS memory partition argument(InImg) type(struct_fields)
+    #pragma HLS memory partition argument(OutImg) type(struct_fields)
+
+    ConvolutionStaticChecks<KERNEL_SIZE, PIXEL_T_IN, PIXEL_T_OUT, W, NPPC>();
+
+    #pragma HLS memory partition variable(KERNEL) type(complete)
+    const SeparableConvolutionKernel<KERNEL_SIZE> KERNEL(CoeffsX, CoeffsY);
+    sev::LineBufferColumnCache<KERNEL_SIZE, NPPC,
+        DT<PIXEL_T_IN, NPPC>::NumChannels, ap_int<8 + 9>> State;
+    #pragma HLS memory partition variable(State) type(complete)
+    State.Reset();
+    ConvolutionStream<KERNEL_SIZE, BORDER, LB_STORAGE>(InImg, OutImg, KERNEL,
+                                                      State, BorderValue);
+}
+
 } // End of namespace vision.
 } // End of namespace hls.
 
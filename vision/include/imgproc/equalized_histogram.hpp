@@ -23,10 +23,58 @@
 #include "../common/common.hpp"
 #include "../common/utils.hpp"
 #include <hls/ap_fixpt.hpp>
+#include "../../../math/include/hls_reciprocal.hpp"
 
 namespace hls {
 namespace vision {
 
+// LUT entry of grey level i, given the cumulative histogram up to i, the first
+// non-zero value of the cumulative histogram and the number of pixels.
+template <int HIST_SIZE>
+uint32_t EqualizationLutEntry(uint32_t cdf, uint32_t min_cdf, uint32_t total_pixels)
+{
+    /*-----------------------------------------------------------------------------
+    * Histogram–equalisation LUT entry
+    *
+    *   g(i) = round( ( CDF(i) - CDF_min ) * (L - 1)
+    *                -------------------------------- )
+    *                (   N        - CDF_min )
+    *
+    * where
+    *   i          : current grey level (0‥255)
+    *   CDF(i)     : cumulative histogram up to level i
+    *   CDF_min    : first non-zero CDF value
+    *   N          : total number of pixels  (H × W)
+    *   L          : number of grey levels   (256 → L − 1 = 255)
+    *
+    * Integer implementation details
+    * --------------------------------
+    *   num = max(CDF(i) - CDF_min, 0)                     // numerator
+    *   val = num * (L - 1)                                // 64-bit product
+    *   den = N - CDF_min                                  // denominator
+    *   g(i) = (den == 0) ? 0                              // degenerate image
+    *          : floor( (val + den/2) / den )              // rounded division
+    *
+    * The division is done with hls::math::divide (a table-seeded reciprocal
+    * and a multiply) instead of a 64-bit integer divider. The estimate can be
+    * off by one, so it is corrected with the remainder to give exactly the
+    * integer quotient.
+    *---------------------------------------------------------------------------*/
+    uint32_t num = (cdf > min_cdf) ? (cdf - min_cdf) : 0;
+    // A 64-bit accumulator (val) guarantees the product cannot overflow when num ≈ H * W.
+    uint64_t val = (uint64_t)num * (HIST_SIZE - 1);
+    uint32_t den = total_pixels - min_cdf;
+    uint32_t safe_den = den ? den : 1;
+    uint64_t rounded = val + (safe_den >> 1); // +½ for rounding
+    ap_uint<9> g = hls::math::divide<24, 9, 2>(ap_ufixpt<64, 64>(rounded), ap_ufixpt<32, 32>(safe_den)).raw_bits() >> 15;
+    ap_uint<41> Product = ap_uint<41>(g) * safe_den;
+    if (Product > rounded)
+        g--;
+    else if (Product + safe_den <= rounded)
+        g++;
+    return den ? (uint32_t)g : 0;
+}
+
 /***************************************************************************//**
  * @brief  Histogram equalisation for a single–channel,
  *         8-bit image stored in a `Img`.
@@ -147,7 +195,6 @@ void EqualizedHistogram(
     uint32_t cdf       = 0;
     uint32_t min_cdf   = 0;
     bool     min_seen  = false;
-    const uint32_t NUMERATOR_SCALE = HIST_SIZE - 1;
 
 CDF_LUT_BUILD:
     #pragma HLS loop pipeline
@@ -159,34 +206,7 @@ CDF_LUT_BUILD:
             min_seen = true;
         }
 
-        /*-----------------------------------------------------------------------------
-        * Histogram–equalisation LUT entry
-        *
-        *   g(i) = round( ( CDF(i) - CDF_min ) * (L - 1)
-        *                -------------------------------- )
-        *                (   N        - CDF_min )
-        *
-        * where
-        *   i          : current grey level (0‥255)
-        *   CDF(i)     : cumulative histogram up to level i
-        *   CDF_min    : first non-zero CDF value
-        *   N          : total number of pixels  (H × W)
-        *   L          : number of grey levels   (256 → L − 1 = 255)
-        *
-        * Integer implementation details
-        * --------------------------------
-        *   num = max(CDF(i) - CDF_min, 0)                     // numerator
-        *   val = num * (L - 1)                                // 64-bit product
-        *   den = N - CDF_min                                  // denominator
-        *   g(i) = (den == 0) ? 0                              // degenerate image
-        *          : floor( (val + den/2) / den )              // rounded division
-        *---------------------------------------------------------------------------*/
-        uint32_t num = (cdf > min_cdf) ? (cdf - min_cdf) : 0;
-        // A 64-bit accumulator (val) guarantees the product cannot overflow when num ≈ H * W.
-        uint64_t val = (uint64_t)num * NUMERATOR_SCALE;
-        uint32_t den = TOTAL_PIXELS - min_cdf;
-        // Integer division with rounding to the nearest integer
-        cdf_lut[i]   = (den ? (val + (den >> 1)) / den : 0); // +½ for rounding
+        cdf_lut[i] = EqualizationLutEntry<HIST_SIZE>(cdf, min_cdf, TOTAL_PIXELS);
     }
 
     /* ------------------------------------------------------------------ */
@@ -199,5 +219,137 @@ WRITE_BACK:
     }
 }
 
+/***************************************************************************//**
+ * @brief  Streaming (video) histogram equalisation for a single-channel,
+ *         8-bit image.
+ *
+ *         Each call maps the frame through the LUT computed from the
+ *         previous call's frame while it builds this frame's histogram, then
+ *         turns that histogram into the LUT for the next call. The first
+ *         frame after reset is passed through unchanged.
+ *
+ *         There is no frame buffer and each pixel is written out in the same
+ *         cycle it is read, which is the usual trade-off for video, where
+ *         consecutive frames have very similar histograms.
+ *
+ * @tparam HIST_SIZE   Number of histogram bins – normally 256.
+ * @tparam PIXEL_T     SmartHLS pixel type (only HLS_8UC1 supported).
+ * @tparam H           Image height  (pixels).
+ * @tparam W           Image width   (pixels).
+ * @tparam STORAGE_TYPE
+ *                     SmartHLS storage enum – can be FIFO or FRAME_BUFFER
+ * @tparam NPPC        Pixels processed per clock – 1, 2, 4 or 8.
+ *
+ * @param[in]  InImg   Source image (frame N).
+ * @param[out] OutImg  Frame N mapped through the LUT of frame N-1.
+ *
+ * @details
+ * * The histogram and the LUT are `static`, so they carry over between
+ *   calls. Each of the NPPC pixel lanes has its own sub-histogram, with the
+ *   last-pixel re-use trick, and its own copy of the LUT, so one pixel word
+ *   is consumed per cycle.
+ * * After the frame, a single HIST_SIZE-long loop sums and clears the
+ *   sub-histograms and builds the new LUT.
+ ******************************************************************************/
+template <
+    int HIST_SIZE = 256,
+    PixelType     PIXEL_T,
+    unsigned      H,
+    unsigned      W,
+    StorageType   STORAGE_TYPE,
+    NumPixelsPerCycle NPPC
+>
+void EqualizedHistogramVideo(
+    Img<PIXEL_T, H, W, STORAGE_TYPE, NPPC> &InImg,
+    Img<PIXEL_T, H, W, STORAGE_TYPE, NPPC> &OutImg)
+{
+    static_assert(DT<PIXEL_T, NPPC>::NumChannels == 1,
+                  "Supports single-channel images only");
+    static_assert(NPPC <= NPPC_8,     "NPPC must be at most 8");
+    static_assert(DT<PIXEL_T, NPPC>::PerChannelPixelWidth == 8,
+                  "Equalization is fixed to 8-bit pixels");
+    static_assert(W % NPPC == 0,
+                  "In EqualizedHistogramVideo, the width of the frame has to be "
+                  "divisible by the number of pixels per clock.");
+
+    const unsigned PixelWidth = DT<PIXEL_T, NPPC>::W / NPPC;
+    using PixelWordT = typename DT<PIXEL_T, NPPC>::T;
+    using PixelT = ap_uint<PixelWidth>;
+
+    const unsigned ImgHeight = InImg.get_height(), ImgWidth = InImg.get_width();
+    const uint32_t TotalPixels = ImgHeight * ImgWidth;
+    OutImg.set_height(ImgHeight);
+    OutImg.set_width(ImgWidth);
+
+    static uint32_t h_tmp[NPPC][HIST_SIZE];
+    #pragma HLS memory partition variable(h_tmp) type(complete) dim(1)
+    static PixelT cdf_lut[NPPC][HIST_SIZE];
+    #pragma HLS memory partition variable(cdf_lut) type(complete) dim(1)
+    static bool lut_valid = false;
+
+    uint8_t  PrevPix[NPPC];
+    uint32_t PrevVal[NPPC];
+    #pragma HLS loop unroll
+    for (int k = 0; k < NPPC; k++) {
+        PrevPix[k] = 0;
+        PrevVal[k] = 0;
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* 1.  Map frame N through LUT(N-1) while building histogram(N)       */
+    /* ------------------------------------------------------------------ */
+HLS_HE_VIDEO_STREAM:
+    #pragma HLS loop pipeline
+    #pragma HLS loop dependence variable(h_tmp) type(inter) direction(RAW) dependent(false)
+    for (int p = 0; p < TotalPixels / NPPC; p++) {
+        PixelWordT InWord = InImg.read(p);
+        PixelWordT OutWord;
+        #pragma HLS loop unroll
+        for (int k = 0; k < NPPC; k++) {
+            PixelT curPix = InWord.byte(k, PixelWidth);
+            OutWord.byte(k, PixelWidth) = lut_valid ? cdf_lut[k][curPix] : curPix;
+
+            uint32_t curVal = h_tmp[k][curPix];
+            if (curPix == PrevPix[k])
+                curVal = PrevVal[k];
+            curVal++;
+            h_tmp[k][curPix] = curVal;
+            PrevPix[k] = curPix;
+            PrevVal[k] = curVal;
+        }
+        OutImg.write(OutWord, p);
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* 2.  Merge and clear the sub-histograms, build LUT(N)               */
+    /* ------------------------------------------------------------------ */
+    uint32_t cdf     = 0;
+    uint32_t min_cdf = 0;
+    bool     min_seen = false;
+
+HLS_HE_VIDEO_LUT_BUILD:
+    #pragma HLS loop pipeline II(1)
+    for (int i = 0; i < HIST_SIZE; ++i) {
+        uint32_t count = 0;
+        #pragma HLS loop unroll
+        for (int k = 0; k < NPPC; k++) {
+            count += h_tmp[k][i];
+            h_tmp[k][i] = 0;
+        }
+        cdf += count;
+
+        if (!min_seen && cdf != 0) {
+            min_cdf  = cdf;
+            min_seen = true;
+        }
+
+        PixelT g = EqualizationLutEntry<HIST_SIZE>(cdf, min_cdf, TotalPixels);
+        #pragma HLS loop unroll
+        for (int k = 0; k < NPPC; k++)
+            cdf_lut[k][i] = g;
+    }
+    lut_valid = true;
+}
+
 } // End of namespace vision.
 } // End of namespace hls.
@@ -62,9 +62,17 @@ constexpr int GaussianBlurKernel(int i, int j) {
                                 : 0;
 }
 
+// 1D kernel of the separable version: GaussianBlurKernel(i, j) is
+// GaussianBlurKernel1D(i) * GaussianBlurKernel1D(j).
+constexpr int GaussianBlurKernel1D(int i) {
+    return (i == 0 || i == 4) ? 1 : (i == 1 || i == 3) ? 4 : (i == 2) ? 6 : 0;
+}
+
 //------------------------------------------------------------------------------
 template <
     unsigned FILTER_SIZE = 5, 
+    BorderType BORDER = BORDER_ZERO,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
     PixelType PIXEL_T_IN, 
     PixelType PIXEL_T_OUT,
     unsigned H, 
@@ -82,15 +90,14 @@ template <
     static_assert(FILTER_SIZE == 5,
                   "Gaussian Blur only supports filter size of 5.");
 
-    static_assert(DT<PIXEL_T_IN, NPPC>::NumChannels == 1 &&
-                      DT<PIXEL_T_OUT, NPPC>::NumChannels == 1,
-                  "Gaussian Blur only supports 1-channel images.");
-                  
     static_assert(W % NPPC == 0,
                   "In GaussianBlur, the width of the frame has to be divisible "
                   "by the number of pixels per clock.");
 
-    vision::Convolution_2d<FILTER_SIZE>(InImg, OutImg, GaussianBlurKernel);
+    // The Gaussian kernel is separable: 5 + 5 multiplies per pixel instead of
+    // 5 * 5.
+    vision::SeparableConvolution_2d<FILTER_SIZE, BORDER, LB_STORAGE>(
+        InImg, OutImg, GaussianBlurKernel1D, GaussianBlurKernel1D);
 }
 
 } // End of namespace vision.
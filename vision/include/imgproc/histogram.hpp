@@ -27,6 +27,15 @@
 namespace hls {
 namespace vision {
 
+/**
+ * Computes the histogram of a one-channel, 8-bit image.
+ *
+ * With NPPC > 1 each lane of the pixel word updates its own private
+ * sub-histogram, so the NPPC updates of a word never conflict. Each lane keeps
+ * the previous-pixel forwarding of the NPPC = 1 version, which keeps the loop
+ * at II = 1. The sub-histograms are summed in the drain loop, which also clears
+ * them for the next frame.
+ */
 template <
     unsigned int HIST_SIZE = 256,
     PixelType PIXEL_T,
@@ -41,43 +50,63 @@ template <
     static_assert(DT<PIXEL_T, NPPC>::NumChannels == 1,
         "Histogram function only supports one channel");
 
-    static_assert(NPPC == 1,
-        "Histogram function only supports one pixel per cycle (NPPC = 1).");
+    static_assert(NPPC <= NPPC_8,
+        "Histogram function only supports up to eight pixels per cycle (NPPC <= 8).");
 
-    static_assert(DT<PIXEL_T, NPPC>::W == 8, 
+    static_assert(DT<PIXEL_T, NPPC>::PerChannelPixelWidth == 8, 
         "Histogram function only supports 8 bits per channel");
 
+    static_assert(W % NPPC == 0,
+        "In Histogram, the width of the frame has to be divisible "
+        "by the number of pixels per clock.");
+
     const unsigned ImgHeight = InImg.get_height(), ImgWidth = InImg.get_width();
+    const unsigned PixelWidth = DT<PIXEL_T, NPPC>::W / NPPC;
+
+    using PixelWordT = typename DT<PIXEL_T, NPPC>::T;
+    using PixelT = ap_uint<PixelWidth>;
 
-    // using PixelWordT = typename DT<PIXEL_T, NPPC>::T;
-    using PixelWordT = ap_uint<DT<PIXEL_T, NPPC>::W>;
+    uint8_t prevPix[NPPC];
+    uint32_t prevVal[NPPC];
 
-    uint8_t prevPix = 0;
-    uint32_t prevVal = 0;
+    static uint32_t h_tmp[NPPC][HIST_SIZE];
+    #pragma HLS memory partition variable(h_tmp) type(complete) dim(1)
 
-    static uint32_t h_tmp[HIST_SIZE];
+    #pragma HLS loop unroll
+    for (int k = 0; k < NPPC; k++) {
+        prevPix[k] = 0;
+        prevVal[k] = 0;
+    }
 
     HLS_VISION_HISTOGRAM_LOOP1:
     #pragma HLS loop pipeline
     #pragma HLS loop dependence variable(h_tmp) type(inter) direction(RAW) dependent(false)
-    for(int p=0; p < ImgHeight * ImgWidth; p++) {
-        PixelWordT curPix = InImg.read(p);
-        uint32_t curVal = h_tmp[curPix];
-        if (prevPix == curPix) {
-            curVal = prevVal;
+    for(int p=0; p < ImgHeight * ImgWidth / NPPC; p++) {
+        PixelWordT curWord = InImg.read(p);
+        #pragma HLS loop unroll
+        for (int k = 0; k < NPPC; k++) {
+            PixelT curPix = curWord.byte(k, PixelWidth);
+            uint32_t curVal = h_tmp[k][curPix];
+            if (prevPix[k] == curPix) {
+                curVal = prevVal[k];
+            }
+            curVal++;
+            h_tmp[k][curPix] = curVal;
+            prevPix[k] = curPix;
+            prevVal[k] = curVal;
         }
-        curVal++;
-        h_tmp[curPix] = curVal;
-        prevPix = curPix;
-        prevVal = curVal;
     }
 
     HLS_VISION_HISTOGRAM_LOOP2:
     #pragma HLS loop pipeline II(1)
     for(int p=0; p < HIST_SIZE; p++) {
-        // printf("h_tmp[%d]:%d\n", p, h_tmp[p]);
-        histogram[p] = h_tmp[p];
-        h_tmp[p] = 0;
+        uint32_t sum = 0;
+        #pragma HLS loop unroll
+        for (int k = 0; k < NPPC; k++) {
+            sum += h_tmp[k][p];
+            h_tmp[k][p] = 0;
+        }
+        histogram[p] = sum;
     }
 }
 
@@ -0,0 +1,273 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY
+// IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A
+// PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT,
+// SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE
+// OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF
+// MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.
+// TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL LIABILITY ON ALL
+// CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID
+// DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP OFFERS NO SUPPORT FOR THE
+// SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#ifndef __SHLS_VISION_MEDIAN_BLUR_HPP__
+#define __SHLS_VISION_MEDIAN_BLUR_HPP__
+
+#include "../common/common.hpp"
+#include "../common/line_buffer.hpp"
+#include "../common/utils.hpp"
+
+namespace hls {
+namespace vision {
+
+//------------------------------------------------------------------------------
+// Sorts v[] in ascending order with an odd-even transposition network:
+// N stages of compare-exchanges between neighbours, N * (N - 1) / 2
+// compare-exchanges in total. Compare-exchanges whose outputs are not used are
+// removed by the synthesis.
+template <unsigned N, typename T> void MedianSortNetwork(T v[N]) {
+    for (unsigned Stage = 0; Stage < N; Stage++) {
+        for (unsigned i = Stage % 2; i + 1 < N; i += 2) {
+            T Min = (v[i] < v[i + 1]) ? v[i] : v[i + 1];
+            T Max = (v[i] < v[i + 1]) ? v[i + 1] : v[i];
+            v[i] = Min;
+            v[i + 1] = Max;
+        }
+    }
+}
+
+// Once the columns and then the rows of a SIZE x SIZE window are sorted, element
+// (i, j) is known to be >= (i + 1) * (j + 1) elements (itself included) and
+// <= (SIZE - i) * (SIZE - j) elements. So only the elements for which both
+// products are <= MedianRank can be the median, and the ones with
+// (SIZE - i) * (SIZE - j) > MedianRank are known to be smaller than it. E.g.
+// for 3x3 only the anti-diagonal is left, and its median is the median of the
+// window.
+constexpr unsigned MedianRank(unsigned SIZE) { return (SIZE * SIZE + 1) / 2; }
+
+constexpr bool MedianCandidate(unsigned SIZE, unsigned i, unsigned j) {
+    return (i + 1) * (j + 1) <= MedianRank(SIZE) &&
+           (SIZE - i) * (SIZE - j) <= MedianRank(SIZE);
+}
+
+constexpr unsigned MedianNumCandidates(unsigned SIZE) {
+    unsigned Count = 0;
+    for (unsigned i = 0; i < SIZE; i++)
+        for (unsigned j = 0; j < SIZE; j++)
+            Count += MedianCandidate(SIZE, i, j);
+    return Count;
+}
+
+constexpr unsigned MedianNumBelow(unsigned SIZE) {
+    unsigned Count = 0;
+    for (unsigned i = 0; i < SIZE; i++)
+        for (unsigned j = 0; j < SIZE; j++)
+            Count += (SIZE - i) * (SIZE - j) > MedianRank(SIZE);
+    return Count;
+}
+
+// The sorted columns of the window, for every pixel of its SIZE words. Each
+// column is sorted once, when it enters the window, and is reused by the SIZE
+// windows that contain it. Byte r of a column is its r-th smallest pixel.
+template <unsigned SIZE, unsigned NPPC, unsigned CHANNELS>
+using MedianColumnCache =
+    sev::LineBufferColumnCache<SIZE, NPPC, CHANNELS, ap_uint<8 * SIZE>>;
+
+//------------------------------------------------------------------------------
+// Shifts the sorted columns along with the window, and sorts the newest column
+// of pixel words. Rows outside the image are padded according to BORDER.
+template <unsigned SIZE, BorderType BORDER, unsigned PIXEL_WIDTH,
+          typename LineBufferT, unsigned NPPC, unsigned CHANNELS>
+void MedianShiftColumns(LineBufferT &LineBuffer, unsigned ImgHeight,
+                        unsigned ImgWords,
+                        MedianColumnCache<SIZE, NPPC, CHANNELS> &State) {
+    State.ShiftColumns();
+
+    // Rows of the window that the rows of the newest column are padded with.
+    unsigned SrcY[SIZE];
+    bool ValidY[SIZE];
+    LineBuffer.template BorderSources<BORDER>(State.Row, ImgHeight, SrcY,
+                                              ValidY);
+
+    for (int k = 0; k < NPPC; k++) {
+        for (int c = 0; c < CHANNELS; c++) {
+            ap_uint<8> Col[SIZE];
+            for (int d = 0; d < SIZE; d++) {
+                ap_uint<PIXEL_WIDTH> Pixel =
+                    LineBuffer.window[SrcY[d]][SIZE - 1].byte(k, PIXEL_WIDTH);
+                Col[d] = ValidY[d] ? ap_uint<8>(Pixel.byte(c, 8)) : ap_uint<8>(0);
+            }
+            MedianSortNetwork<SIZE>(Col);
+            for (int r = 0; r < SIZE; r++)
+                State.Column[SIZE - 1][k][c].byte(r, 8) = Col[r];
+        }
+    }
+    State.NextWord(ImgWords);
+}
+
+//------------------------------------------------------------------------------
+template <unsigned SIZE, BorderType BORDER, PixelType PIXEL_T, unsigned H,
+          unsigned W, StorageType STORAGE_IN, StorageType STORAGE_OUT,
+          NumPixelsPerCycle NPPC, typename LineBufferT, unsigned STATE_NPPC,
+          unsigned CHANNELS>
+void MedianBlurProcess(vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+                       vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg,
+                       LineBufferT &LineBuffer, unsigned &i, unsigned &j,
+                       MedianColumnCache<SIZE, STATE_NPPC, CHANNELS> &State) {
+    using PixelWordT = typename DT<PIXEL_T, NPPC>::T;
+    const unsigned PixelWidth = DT<PIXEL_T, NPPC>::W / NPPC;
+    const unsigned ImgWidth = InImg.get_width();
+    const unsigned ImgIdx = i * (ImgWidth / NPPC) + j;
+    const unsigned NumCandidates = MedianNumCandidates(SIZE);
+
+    PixelWordT OutPixelWord;
+    for (int k = 0; k < NPPC; k++) {
+        // Pixel columns of the window that the columns around pixel k are
+        // padded with.
+        unsigned SrcX[SIZE];
+        bool ValidX[SIZE];
+        LineBuffer.template BorderPixelColumns<BORDER>(j, k, ImgWidth, SrcX,
+                                                       ValidX);
+
+        ap_uint<PixelWidth> OutPixel;
+        for (int c = 0; c < CHANNELS; c++) {
+            // Sort the rows of the window made of sorted columns.
+            ap_uint<8> Window[SIZE][SIZE];
+            for (int r = 0; r < SIZE; r++) {
+                for (int d = 0; d < SIZE; d++) {
+                    Window[r][d] =
+                        ValidX[d]
+                            ? ap_uint<8>(State.Column[SrcX[d] / NPPC]
+                                                     [SrcX[d] % NPPC][c]
+                                                         .byte(r, 8))
+                            : ap_uint<8>(0);
+                }
+                MedianSortNetwork<SIZE>(Window[r]);
+            }
+
+            // The median of the window is the median of the candidates.
+            ap_uint<8> Candidates[NumCandidates];
+            unsigned n = 0;
+            for (int r = 0; r < SIZE; r++) {
+                for (int d = 0; d < SIZE; d++) {
+                    if (MedianCandidate(SIZE, r, d))
+                        Candidates[n++] = Window[r][d];
+                }
+            }
+            MedianSortNetwork<NumCandidates>(Candidates);
+            OutPixel.byte(c, 8) =
+                Candidates[MedianRank(SIZE) - MedianNumBelow(SIZE) - 1];
+        }
+        OutPixelWord.byte(k, PixelWidth) = OutPixel;
+    }
+
+    OutImg.write(OutPixelWord, ImgIdx);
+    if (j < (W / NPPC) - 1) {
+        j++;
+    } else {
+        i++;
+        j = 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Replaces every pixel by the median of the SIZE x SIZE window around it, for
+// each channel separately. The pixels outside of the image are padded
+// according to BORDER (BORDER_CONSTANT pads with 0). LB_STORAGE selects how
+// the LineBuffer stores the previous rows (see LineBufferStorage).
+template <
+    unsigned SIZE = 3,
+    BorderType BORDER = BORDER_REPLICATE,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T,
+    unsigned H,
+    unsigned W,
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1
+> void MedianBlur(
+    vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg
+) {
+    #pragma HLS memory partition argument(InImg) type(struct_fields)
+    #pragma HLS memory partition argument(OutImg) type(struct_fields)
+
+    static_assert(SIZE == 3 || SIZE == 5,
+                  "MedianBlur only supports SIZE of 3 or 5.");
+    static_assert(DT<PIXEL_T, NPPC>::PerChannelPixelWidth == 8,
+                  "MedianBlur: Channel width must be 8.");
+    static_assert(W % NPPC == 0,
+                  "In MedianBlur, the width of the frame has to be divisible "
+                  "by the number of pixels per clock.");
+
+    using PixelWordT = typename DT<PIXEL_T, NPPC>::T;
+    const unsigned PixelWidth = DT<PIXEL_T, NPPC>::W / NPPC;
+    const unsigned NumChannels = DT<PIXEL_T, NPPC>::NumChannels;
+
+    const unsigned ImgHeight = InImg.get_height(), ImgWidth = InImg.get_width();
+    OutImg.set_height(ImgHeight);
+    OutImg.set_width(ImgWidth);
+
+    const unsigned FrameSize = (ImgHeight * ImgWidth) / NPPC;
+    LineBufferWithStorage<PixelWordT, W / NPPC, SIZE, PixelWidth, NPPC,
+                          LB_STORAGE>
+        LineBuffer;
+    MedianColumnCache<SIZE, NPPC, NumChannels> State;
+    #pragma HLS memory partition variable(State) type(complete)
+    State.Reset();
+
+    // The window is centred on its word `Radius` (see
+    // LineBuffer::AccessWindow()), so the input has to be `Radius` rows plus
+    // `Radius` pixel words ahead of the output.
+    const unsigned Radius = SIZE / 2;
+    const unsigned LineBufferPixelWordFillCount =
+        Radius * (ImgWidth / NPPC + 1);
+
+    // 1. Fill LineBuffer only
+    #pragma HLS loop pipeline
+    for (unsigned Count = 0; Count < LineBufferPixelWordFillCount; Count++) {
+        auto InPixelWord = InImg.read(Count);
+        LineBuffer.ShiftInPixel(InPixelWord);
+        MedianShiftColumns<SIZE, BORDER, PixelWidth>(LineBuffer, ImgHeight,
+                                                     ImgWidth / NPPC, State);
+    }
+
+    // 2. Fill LineBuffer and process (steady state)
+    // i and j are the row and col indices of the current pixel word being
+    // processed. They'll be incremented by MedianBlurProcess().
+    unsigned i = 0, j = 0;
+    #pragma HLS loop pipeline
+    for (unsigned Count = LineBufferPixelWordFillCount; Count < FrameSize;
+         Count++) {
+        auto InPixelWord = InImg.read(Count);
+        LineBuffer.ShiftInPixel(InPixelWord);
+        MedianShiftColumns<SIZE, BORDER, PixelWidth>(LineBuffer, ImgHeight,
+                                                     ImgWidth / NPPC, State);
+        MedianBlurProcess<SIZE, BORDER>(InImg, OutImg, LineBuffer, i, j,
+                                        State);
+    }
+
+    // 3. Process only (flush out). The input to LineBuffer is 0.
+    #pragma HLS loop pipeline
+    for (unsigned Count = FrameSize;
+         Count < FrameSize + LineBufferPixelWordFillCount; Count++) {
+        LineBuffer.ShiftInPixel(0);
+        MedianShiftColumns<SIZE, BORDER, PixelWidth>(LineBuffer, ImgHeight,
+                                                     ImgWidth / NPPC, State);
+        MedianBlurProcess<SIZE, BORDER>(InImg, OutImg, LineBuffer, i, j,
+                                        State);
+    }
+}
+
+} // End of namespace vision.
+} // End of namespace hls.
+
+#endif
@@ -0,0 +1,580 @@
+// ©2026 Microchip Technology Inc. and its subsidiaries
+//
+// Subject to your compliance with these terms, you may use this Microchip
+// software and any derivatives exclusively with Microchip products. You are
+// responsible for complying with third party license terms applicable to your
+// use of third party software (including open source software) that may
+// accompany this Microchip software. SOFTWARE IS “AS IS.” NO WARRANTIES,
+// WHETHER EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY
+// IMPLIED WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A
+// PARTICULAR PURPOSE. IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT,
+// SPECIAL, PUNITIVE, INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE
+// OF ANY KIND WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF
+// MICROCHIP HAS BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE.
+// TO THE FULLEST EXTENT ALLOWED BY LAW, MICROCHIP’S TOTAL LIABILITY ON ALL
+// CLAIMS LATED TO THE SOFTWARE WILL NOT EXCEED AMOUNT OF FEES, IF ANY, YOU PAID
+// DIRECTLY TO MICROCHIP FOR THIS SOFTWARE. MICROCHIP OFFERS NO SUPPORT FOR THE
+// SOFTWARE. YOU MAY CONTACT MICROCHIP AT
+// https://www.microchip.com/en-us/support-and-training/design-help/client-support-services
+// TO INQUIRE ABOUT SUPPORT SERVICES AND APPLICABLE FEES, IF AVAILABLE.
+
+#ifndef __SHLS_VISION_MORPHOLOGY_HPP__
+#define __SHLS_VISION_MORPHOLOGY_HPP__
+
+#include "../common/common.hpp"
+#include "../common/line_buffer.hpp"
+#include "../common/utils.hpp"
+
+namespace hls {
+namespace vision {
+
+enum MorphologyOp { MORPH_ERODE, MORPH_DILATE };
+
+//------------------------------------------------------------------------------
+// Structuring element: the pixels of the SIZE x SIZE window for which
+// mask[i][j] is true are part of the min (erode) or max (dilate).
+template <int SIZE>
+struct MorphologyMask {
+    bool mask[SIZE][SIZE];
+
+    template<typename Func>
+    MorphologyMask(Func Functor) {
+        for (int i=0; i< SIZE; i++) {
+            for (int j=0; j<SIZE; j++){
+                mask[i][j]=Functor(i, j);
+            }
+        }
+    }
+    // Runtime mask, e.g. from an AXI target array.
+    MorphologyMask(const bool Mask[SIZE][SIZE]) {
+        for (int i=0; i< SIZE; i++) {
+            for (int j=0; j<SIZE; j++){
+                mask[i][j]=Mask[i][j];
+            }
+        }
+    }
+    bool getElement(int i, int j) const {
+        return mask[i][j];
+    }
+};
+
+// The full SIZE x SIZE rectangle, computed as a column pass followed by a row
+// pass over the column results.
+struct MorphologyRect {};
+
+// The arbitrary mask keeps no state between pixel words. The rectangle keeps
+// the min/max of every column of the window in a LineBufferColumnCache.
+struct MorphologyNoState {};
+
+//------------------------------------------------------------------------------
+template <MorphologyOp OP>
+ap_uint<8> MorphologyReduce(ap_uint<8> a, ap_uint<8> b) {
+    if (OP == MORPH_ERODE)
+        return (a < b) ? a : b;
+    else
+        return (a > b) ? a : b;
+}
+
+// The value that never changes the result: 255 for erode, 0 for dilate.
+template <MorphologyOp OP> ap_uint<8> MorphologyNeutral() {
+    return (OP == MORPH_ERODE) ? 255 : 0;
+}
+
+// Padding of the pixels outside of the image. BORDER_CONSTANT pads with the
+// value that never changes the result (255 for erode, 0 for dilate), as
+// OpenCV's default border of erode/dilate does. BORDER_ZERO pads with 0.
+template <MorphologyOp OP, BorderType BORDER, unsigned PIXEL_WIDTH>
+ap_uint<PIXEL_WIDTH> MorphologyPadding() {
+    ap_uint<PIXEL_WIDTH> Padding = 0;
+    if (BORDER == BORDER_CONSTANT) {
+        for (int c = 0; c < PIXEL_WIDTH / 8; c++)
+            Padding.byte(c, 8) = MorphologyNeutral<OP>();
+    }
+    return Padding;
+}
+
+//------------------------------------------------------------------------------
+// Called for every pixel word shifted into the LineBuffer, including the fill
+// phase. Nothing to do for an arbitrary mask.
+template <MorphologyOp OP, unsigned SIZE, BorderType BORDER,
+          unsigned PIXEL_WIDTH, typename LineBufferT>
+void MorphologyShiftColumns(LineBufferT &LineBuffer, unsigned ImgHeight,
+                            unsigned ImgWords, MorphologyNoState &State) {}
+
+// Shifts the column results along with the window, and reduces the newest
+// column of pixel words. Rows outside the image are padded according to
+// BORDER.
+template <MorphologyOp OP, unsigned SIZE, BorderType BORDER,
+          unsigned PIXEL_WIDTH, typename LineBufferT, unsigned NPPC,
+          unsigned CHANNELS>
+void MorphologyShiftColumns(LineBufferT &LineBuffer, unsigned ImgHeight,
+                            unsigned ImgWords,
+                            sev::LineBufferColumnCache<SIZE, NPPC, CHANNELS,
+                                                       ap_uint<8>> &State) {
+    const ap_uint<PIXEL_WIDTH> Padding =
+        MorphologyPadding<OP, BORDER, PIXEL_WIDTH>();
+
+    // Rows of the window that the rows of the newest column are padded with.
+    unsigned SrcY[SIZE];
+    bool ValidY[SIZE];
+    LineBuffer.template BorderSources<BORDER>(State.Row, ImgHeight, SrcY,
+                                              ValidY);
+
+    State.ShiftColumns();
+
+    for (int k = 0; k < NPPC; k++) {
+        for (int c = 0; c < CHANNELS; c++) {
+            ap_uint<8> Result = MorphologyNeutral<OP>();
+            for (int d = 0; d < SIZE; d++) {
+                ap_uint<PIXEL_WIDTH> Pixel =
+                    ValidY[d] ? ap_uint<PIXEL_WIDTH>(
+                                    LineBuffer.window[SrcY[d]][SIZE - 1].byte(
+                                        k, PIXEL_WIDTH))
+                              : Padding;
+                Result = MorphologyReduce<OP>(Result, Pixel.byte(c, 8));
+            }
+            State.Column[SIZE - 1][k][c] = Result;
+        }
+    }
+    State.NextWord(ImgWords);
+}
+
+//------------------------------------------------------------------------------
+// Arbitrary mask: min/max over the masked pixels of the padded window.
+template <MorphologyOp OP, unsigned SIZE, BorderType BORDER, PixelType PIXEL_T,
+          unsigned H, unsigned W, StorageType STORAGE_IN,
+          StorageType STORAGE_OUT, NumPixelsPerCycle NPPC, typename LineBufferT>
+void MorphologyProcess(vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+                       vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg,
+                       LineBufferT &LineBuffer, unsigned &i, unsigned &j,
+                       const MorphologyMask<SIZE> &MASK,
+                       MorphologyNoState &State) {
+    using PixelWordT = typename DT<PIXEL_T, NPPC>::T;
+    const unsigned PixelWidth = DT<PIXEL_T, NPPC>::W / NPPC;
+    const unsigned NumChannels = DT<PIXEL_T, NPPC>::NumChannels;
+    const unsigned ImgHeight = InImg.get_height(), ImgWidth = InImg.get_width();
+    const unsigned ImgIdx = i * (ImgWidth / NPPC) + j;
+    const ap_uint<PixelWidth> Padding =
+        MorphologyPadding<OP, BORDER, PixelWidth>();
+
+    PixelWordT OutPixelWord;
+    for (int k = 0; k < NPPC; k++) {
+        ap_uint<PixelWidth> Window[SIZE][SIZE];
+        LineBuffer.template GetWindow<BORDER>(Window, i, j, k, ImgHeight,
+                                              ImgWidth, Padding);
+
+        ap_uint<PixelWidth> OutPixel;
+        for (int c = 0; c < NumChannels; c++) {
+            // An empty mask outputs the neutral value.
+            ap_uint<8> Result = MorphologyNeutral<OP>();
+            for (int y = 0; y < SIZE; y++) {
+                for (int x = 0; x < SIZE; x++) {
+                    if (MASK.getElement(y, x))
+                        Result = MorphologyReduce<OP>(
+                            Result, Window[y][x].byte(c, 8));
+                }
+            }
+            OutPixel.byte(c, 8) = Result;
+        }
+        OutPixelWord.byte(k, PixelWidth) = OutPixel;
+    }
+
+    OutImg.write(OutPixelWord, ImgIdx);
+    if (j < (W / NPPC) - 1) {
+        j++;
+    } else {
+        i++;
+        j = 0;
+    }
+}
+
+// Rectangle: min/max over the column results kept in State, SIZE compares per
+// channel and pixel.
+template <MorphologyOp OP, unsigned SIZE, BorderType BORDER, PixelType PIXEL_T,
+          unsigned H, unsigned W, StorageType STORAGE_IN,
+          StorageType STORAGE_OUT, NumPixelsPerCycle NPPC, typename LineBufferT,
+          unsigned STATE_NPPC, unsigned CHANNELS>
+void MorphologyProcess(vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+                       vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg,
+                       LineBufferT &LineBuffer, unsigned &i, unsigned &j,
+                       const MorphologyRect &MASK,
+                       sev::LineBufferColumnCache<SIZE, STATE_NPPC, CHANNELS,
+                                                  ap_uint<8>> &State) {
+    using PixelWordT = typename DT<PIXEL_T, NPPC>::T;
+    const unsigned PixelWidth = DT<PIXEL_T, NPPC>::W / NPPC;
+    const unsigned ImgWidth = InImg.get_width();
+    const unsigned ImgIdx = i * (ImgWidth / NPPC) + j;
+    const ap_uint<PixelWidth> Padding =
+        MorphologyPadding<OP, BORDER, PixelWidth>();
+
+    PixelWordT OutPixelWord;
+    for (int k = 0; k < NPPC; k++) {
+        // Pixel columns of the window that the columns around pixel k are
+        // padded with.
+        unsigned SrcX[SIZE];
+        bool ValidX[SIZE];
+        LineBuffer.template BorderPixelColumns<BORDER>(j, k, ImgWidth, SrcX,
+                                                       ValidX);
+
+        ap_uint<PixelWidth> OutPixel;
+        for (int c = 0; c < CHANNELS; c++) {
+            ap_uint<8> Result = MorphologyNeutral<OP>();
+            for (int d = 0; d < SIZE; d++) {
+                ap_uint<8> ColExtreme =
+                    ValidX[d]
+                        ? State.Column[SrcX[d] / NPPC][SrcX[d] % NPPC][c]
+                        : ap_uint<8>(Padding.byte(c, 8));
+                Result = MorphologyReduce<OP>(Result, ColExtreme);
+            }
+            OutPixel.byte(c, 8) = Result;
+        }
+        OutPixelWord.byte(k, PixelWidth) = OutPixel;
+    }
+
+    OutImg.write(OutPixelWord, ImgIdx);
+    if (j < (W / NPPC) - 1) {
+        j++;
+    } else {
+        i++;
+        j = 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Streams the image through the LineBuffer and calls MorphologyProcess() for
+// every output pixel word. Shared by all the morphology functions.
+template <MorphologyOp OP, unsigned SIZE, BorderType BORDER,
+          LineBufferStorage LB_STORAGE, PixelType PIXEL_T, unsigned H,
+          unsigned W, StorageType STORAGE_IN, StorageType STORAGE_OUT,
+          NumPixelsPerCycle NPPC, typename MaskT, typename StateT>
+void MorphologyStream(vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+                      vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg,
+                      const MaskT &MASK, StateT &State) {
+    using PixelWordT = typename DT<PIXEL_T, NPPC>::T;
+    const unsigned PixelWidth = DT<PIXEL_T, NPPC>::W / NPPC;
+
+    const unsigned ImgHeight = InImg.get_height(), ImgWidth = InImg.get_width();
+    OutImg.set_height(ImgHeight);
+    OutImg.set_width(ImgWidth);
+
+    const unsigned FrameSize = (ImgHeight * ImgWidth) / NPPC;
+    LineBufferWithStorage<PixelWordT, W / NPPC, SIZE, PixelWidth, NPPC,
+                          LB_STORAGE>
+        LineBuffer;
+    // The window is centred on its word `Radius` (see
+    // LineBuffer::AccessWindow()), so the input has to be `Radius` rows plus
+    // `Radius` pixel words ahead of the output.
+    const unsigned Radius = SIZE / 2;
+    const unsigned LineBufferPixelWordFillCount =
+        Radius * (ImgWidth / NPPC + 1);
+
+    // 1. Fill LineBuffer only
+    #pragma HLS loop pipeline
+    for (unsigned Count = 0; Count < LineBufferPixelWordFillCount; Count++) {
+        auto InPixelWord = InImg.read(Count);
+        LineBuffer.ShiftInPixel(InPixelWord);
+        MorphologyShiftColumns<OP, SIZE, BORDER, PixelWidth>(
+            LineBuffer, ImgHeight, ImgWidth / NPPC, State);
+    }
+
+    // 2. Fill LineBuffer and process (steady state)
+    // i and j are the row and col indices of the current pixel word being
+    // processed. They'll be incremented by MorphologyProcess().
+    unsigned i = 0, j = 0;
+    #pragma HLS loop pipeline
+    for (unsigned Count = LineBufferPixelWordFillCount; Count < FrameSize;
+         Count++) {
+        auto InPixelWord = InImg.read(Count);
+        LineBuffer.ShiftInPixel(InPixelWord);
+        MorphologyShiftColumns<OP, SIZE, BORDER, PixelWidth>(
+            LineBuffer, ImgHeight, ImgWidth / NPPC, State);
+        MorphologyProcess<OP, SIZE, BORDER>(InImg, OutImg, LineBuffer, i, j,
+                                            MASK, State);
+    }
+
+    // 3. Process only (flush out). The input to LineBuffer is 0.
+    #pragma HLS loop pipeline
+    for (unsigned Count = FrameSize;
+         Count < FrameSize + LineBufferPixelWordFillCount; Count++) {
+        LineBuffer.ShiftInPixel(0);
+        MorphologyShiftColumns<OP, SIZE, BORDER, PixelWidth>(
+            LineBuffer, ImgHeight, ImgWidth / NPPC, State);
+        MorphologyProcess<OP, SIZE, BORDER>(InImg, OutImg, LineBuffer, i, j,
+                                            MASK, State);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Checks shared by all the morphology functions.
+template <unsigned SIZE, PixelType PIXEL_T, unsigned W, NumPixelsPerCycle NPPC>
+void MorphologyStaticChecks() {
+    static_assert(SIZE % 2 == 1 && SIZE >= 3,
+                  "Morphology: SIZE must be odd and at least 3.");
+    static_assert(DT<PIXEL_T, NPPC>::PerChannelPixelWidth == 8,
+                  "Morphology: Channel width must be 8.");
+    static_assert(W % NPPC == 0,
+                  "In Morphology, the width of the frame has to be divisible "
+                  "by the number of pixels per clock.");
+}
+
+//------------------------------------------------------------------------------
+// Erodes (min) or dilates (max) the image with the SIZE x SIZE rectangle as
+// the structuring element. The rectangle is decomposed into a column and a row
+// pass, 2 * SIZE compares per channel and pixel instead of SIZE * SIZE.
+// LB_STORAGE selects how the LineBuffer stores the previous rows (see
+// LineBufferStorage).
+template <
+    MorphologyOp OP,
+    unsigned SIZE = 3,
+    BorderType BORDER = BORDER_CONSTANT,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T,
+    unsigned H,
+    unsigned W,
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1
+> void Morphology(
+    vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg
+) {
+    #pragma HLS memory partition argument(InImg) type(struct_fields)
+    #pragma HLS memory partition argument(OutImg) type(struct_fields)
+
+    MorphologyStaticChecks<SIZE, PIXEL_T, W, NPPC>();
+
+    const MorphologyRect MASK;
+    sev::LineBufferColumnCache<SIZE, NPPC, DT<PIXEL_T, NPPC>::NumChannels,
+                               ap_uint<8>>
+        State;
+    #pragma HLS memory partition variable(State) type(complete)
+    State.Reset();
+    MorphologyStream<OP, SIZE, BORDER, LB_STORAGE>(InImg, OutImg, MASK, State);
+}
+
+// Same as above, with the structuring element given by a compile-time
+// `constexpr bool Functor(int i, int j)`, e.g. a cross or a disk. Only the
+// pixels of the mask are compared.
+template <
+    MorphologyOp OP,
+    unsigned SIZE = 3,
+    BorderType BORDER = BORDER_CONSTANT,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T,
+    unsigned H,
+    unsigned W,
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1,
+    typename Func
+> void Morphology(
+    vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg,
+    Func Functor
+) {
+    #pragma HLS memory partition argument(InImg) type(struct_fields)
+    #pragma HLS memory partition argument(OutImg) type(struct_fields)
+
+    MorphologyStaticChecks<SIZE, PIXEL_T, W, NPPC>();
+
+    #pragma HLS memory replicate_rom variable(MASK.mask) max_replicas(0)
+    static const MorphologyMask<SIZE> MASK(Functor);
+    MorphologyNoState State;
+    MorphologyStream<OP, SIZE, BORDER, LB_STORAGE>(InImg, OutImg, MASK, State);
+}
+
+// Same as above, with the mask given at runtime. The array is copied into
+// registers once per frame, so it can be an AXI target argument of the
+// top-level function and be changed between frames without resynthesis.
+template <
+    MorphologyOp OP,
+    unsigned SIZE = 3,
+    BorderType BORDER = BORDER_CONSTANT,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T,
+    unsigned H,
+    unsigned W,
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1
+> void Morphology_Runtime(
+    vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg,
+    const bool Mask[SIZE][SIZE]
+) {
+    #pragma HLS memory partition argument(InImg) type(struct_fields)
+    #pragma HLS memory partition argument(OutImg) type(struct_fields)
+
+    MorphologyStaticChecks<SIZE, PIXEL_T, W, NPPC>();
+
+    #pragma HLS memory partition variable(MASK) type(complete)
+    const MorphologyMask<SIZE> MASK(Mask);
+    MorphologyNoState State;
+    MorphologyStream<OP, SIZE, BORDER, LB_STORAGE>(InImg, OutImg, MASK, State);
+}
+
+//------------------------------------------------------------------------------
+template <
+    unsigned SIZE = 3,
+    BorderType BORDER = BORDER_CONSTANT,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T,
+    unsigned H,
+    unsigned W,
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1
+> void Erode(
+    vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg
+) {
+    Morphology<MORPH_ERODE, SIZE, BORDER, LB_STORAGE>(InImg, OutImg);
+}
+
+template <
+    unsigned SIZE = 3,
+    BorderType BORDER = BORDER_CONSTANT,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T,
+    unsigned H,
+    unsigned W,
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1,
+    typename Func
+> void Erode(
+    vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg,
+    Func Functor
+) {
+    Morphology<MORPH_ERODE, SIZE, BORDER, LB_STORAGE>(InImg, OutImg, Functor);
+}
+
+template <
+    unsigned SIZE = 3,
+    BorderType BORDER = BORDER_CONSTANT,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T,
+    unsigned H,
+    unsigned W,
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1
+> void Dilate(
+    vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg
+) {
+    Morphology<MORPH_DILATE, SIZE, BORDER, LB_STORAGE>(InImg, OutImg);
+}
+
+template <
+    unsigned SIZE = 3,
+    BorderType BORDER = BORDER_CONSTANT,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T,
+    unsigned H,
+    unsigned W,
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1,
+    typename Func
+> void Dilate(
+    vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg,
+    Func Functor
+) {
+    Morphology<MORPH_DILATE, SIZE, BORDER, LB_STORAGE>(InImg, OutImg, Functor);
+}
+
+//------------------------------------------------------------------------------
+// Opening (erode then dilate) and closing (dilate then erode). Both steps run
+// concurrently in one dataflow region, connected by a FIFO, so the
+// intermediate frame is never stored to memory.
+template <
+    unsigned SIZE = 3,
+    BorderType BORDER = BORDER_CONSTANT,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T,
+    unsigned H,
+    unsigned W,
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1
+> void MorphologyOpen(
+    vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg
+) {
+#pragma HLS function dataflow
+    Img<PIXEL_T, H, W, StorageType::FIFO, NPPC> ErodeImg;
+    Morphology<MORPH_ERODE, SIZE, BORDER, LB_STORAGE>(InImg, ErodeImg);
+    Morphology<MORPH_DILATE, SIZE, BORDER, LB_STORAGE>(ErodeImg, OutImg);
+}
+
+template <
+    unsigned SIZE = 3,
+    BorderType BORDER = BORDER_CONSTANT,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T,
+    unsigned H,
+    unsigned W,
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1,
+    typename Func
+> void MorphologyOpen(
+    vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg,
+    Func Functor
+) {
+#pragma HLS function dataflow
+    Img<PIXEL_T, H, W, StorageType::FIFO, NPPC> ErodeImg;
+    Morphology<MORPH_ERODE, SIZE, BORDER, LB_STORAGE>(InImg, ErodeImg, Functor);
+    Morphology<MORPH_DILATE, SIZE, BORDER, LB_STORAGE>(ErodeImg, OutImg, Functor);
+}
+
+template <
+    unsigned SIZE = 3,
+    BorderType BORDER = BORDER_CONSTANT,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T,
+    unsigned H,
+    unsigned W,
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1
+> void MorphologyClose(
+    vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg
+) {
+#pragma HLS function dataflow
+    Img<PIXEL_T, H, W, StorageType::FIFO, NPPC> DilateImg;
+    Morphology<MORPH_DILATE, SIZE, BORDER, LB_STORAGE>(InImg, DilateImg);
+    Morphology<MORPH_ERODE, SIZE, BORDER, LB_STORAGE>(DilateImg, OutImg);
+}
+
+template <
+    unsigned SIZE = 3,
+    BorderType BORDER = BORDER_CONSTANT,
+    LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+    PixelType PIXEL_T,
+    unsigned H,
+    unsigned W,
+    StorageType STORAGE_IN = StorageType::FIFO,
+    StorageType STORAGE_OUT = StorageType::FIFO,
+    NumPixelsPerCycle NPPC = NPPC_1,
+    typename Func
+> void MorphologyClose(
+    vision::Img<PIXEL_T, H, W, STORAGE_IN, NPPC> &InImg,
+    vision::Img<PIXEL_T, H, W, STORAGE_OUT, NPPC> &OutImg,
+    Func Functor
+) {
+#pragma HLS function dataflow
+    Img<PIXEL_T, H, W, StorageType::FIFO, NPPC> DilateImg;
+    Morphology<MORPH_DILATE, SIZE, BORDER, LB_STORAGE>(InImg, DilateImg, Functor);
+    Morphology<MORPH_ERODE, SIZE, BORDER, LB_STORAGE>(DilateImg, OutImg, Functor);
+}
+
+} // End of namespace vision.
+} // End of namespace hls.
+
+#endif
@@ -31,14 +31,12 @@ namespace vision {
 
 template <PixelType PIXEL_T_IN, PixelType PIXEL_T_OUT, unsigned H, unsigned W,
           StorageType STORAGE_IN, StorageType STORAGE_OUT,
-          NumPixelsPerCycle NPPC>
+          NumPixelsPerCycle NPPC, typename LineBufferT>
 void NonMaxSuppProcess(
     vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
     vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InDirection,
     vision::Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg,
-    LineBuffer<typename DT<PIXEL_T_IN, NPPC>::T, W / NPPC, 3,
-               DT<PIXEL_T_IN, NPPC>::W / NPPC, unsigned(NPPC)> &LineBuffer,
-    unsigned &i, unsigned &j) {
+    LineBufferT &LineBuffer, unsigned &i, unsigned &j) {
 
     using OutPixelWordT = typename DT<PIXEL_T_OUT, NPPC>::T;
 
@@ -56,25 +54,10 @@ void NonMaxSuppProcess(
 
     // Now do the non-max suppression at the current point:
     for (int k = 0; k < NPPC; k++) {
-        // Initialize the input window from LineBuffer.window. If the coordinate
-        // is out-of-bound, set the value to 0 (i.e., zero-padding).
-        TmpPixelT Window[3][3];
-        for (int OffsetY = -1; OffsetY <= 1; OffsetY++) {
-            for (int OffsetX = -1; OffsetX <= 1; OffsetX++) {
-                int y = i + OffsetY, x = j * NPPC + k + OffsetX;
-                bool WindowOutOfBounds =
-                    (y < 0) | (y >= ImgHeight) | (x < 0) | (x >= ImgWidth);
-                // Array indices start from 0 so we need to "recalibrate" the
-                // index by adding `FilterRadius`. E.g., for 3x3 filter, the
-                // offset is from -1 to 1. To turn it into 0-based index, we
-                // need to add 1.
-                int ArrayIdxY = OffsetY + 1, ArrayIdxX = OffsetX + 1;
-                Window[ArrayIdxY][ArrayIdxX] =
-                    WindowOutOfBounds ? TmpPixelT(0)
-                                      : TmpPixelT(LineBuffer.AccessWindow(
-                                            ArrayIdxY, ArrayIdxX, k));
-            }
-        }
+        // Get the input window from LineBuffer. Out-of-bound neighbours are 0
+        // (i.e., zero-padding), so they never suppress a pixel on the border.
+        ap_uint<InPixelWidth> Window[3][3];
+        LineBuffer.GetWindow(Window, i, j, k, ImgHeight, ImgWidth);
 
         /* Non-maximum suppression algorithm:
         * Each pixel has a corresponding gradient direction, which is assumed
@@ -172,7 +155,8 @@ void NonMaxSuppProcess(
 
 // TODO T:
 // - Add support for multiple channels.
-template <PixelType PIXEL_T_IN, PixelType PIXEL_T_OUT, unsigned H, unsigned W,
+template <LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+          PixelType PIXEL_T_IN, PixelType PIXEL_T_OUT, unsigned H, unsigned W,
           StorageType STORAGE_IN = StorageType::FIFO,
           StorageType STORAGE_OUT = StorageType::FIFO,
           NumPixelsPerCycle NPPC = NPPC_1>
@@ -198,7 +182,9 @@ void NonMaximumSuppression(
 
     const unsigned FrameSize = (ImgHeight * ImgWidth) / NPPC;
     const unsigned InPixelWidth = DT<PIXEL_T_IN, NPPC>::W / NPPC;
-    LineBuffer<InPixelWordT, W / NPPC, 3, InPixelWidth, NPPC> LineBuffer;
+    LineBufferWithStorage<InPixelWordT, W / NPPC, 3, InPixelWidth, NPPC,
+                          LB_STORAGE>
+        LineBuffer;
     // The LineBuffer needs to be filled for 1 row, plus 1 pixel.
     const unsigned LineBufferPixelWordFillCount = ImgWidth / NPPC + 1;
 
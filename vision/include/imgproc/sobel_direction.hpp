@@ -32,16 +32,14 @@ namespace vision {
 
 // Only support 3x3 for now for quick prototyping.
 // Also assume [0, 255] pixel range.
-template <unsigned FILTER_SIZE, PixelType PIXEL_T_IN, PixelType PIXEL_T_OUT,
-          unsigned H, unsigned W, StorageType STORAGE_IN,
-          StorageType STORAGE_OUT, NumPixelsPerCycle NPPC>
+template <unsigned FILTER_SIZE, BorderType BORDER, PixelType PIXEL_T_IN,
+          PixelType PIXEL_T_OUT, unsigned H, unsigned W, StorageType STORAGE_IN,
+          StorageType STORAGE_OUT, NumPixelsPerCycle NPPC, typename LineBufferT>
 void SobelProcess(
     vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
     vision::Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutImg,
     vision::Img<PIXEL_T_OUT, H, W, STORAGE_OUT, NPPC> &OutDirection,
-    LineBuffer<typename DT<PIXEL_T_IN, NPPC>::T, W / NPPC, FILTER_SIZE,
-               DT<PIXEL_T_IN, NPPC>::W / NPPC, unsigned(NPPC)> &LineBuffer,
-    unsigned &i, unsigned &j) {
+    LineBufferT &LineBuffer, unsigned &i, unsigned &j) {
 
     using OutPixelWordT = typename DT<PIXEL_T_OUT, NPPC>::T;
 
@@ -65,27 +63,11 @@ void SobelProcess(
     // - OutGy = dot_product(KernelY, Window)
     const int FilterRadius = FILTER_SIZE / 2; // e.g., 1 if FILTER_SIZE is 3.
     for (int k = 0; k < NPPC; k++) {
-        // Initialize the input window from LineBuffer.window. If the coordinate
-        // is out-of-bound, set the value to 0 (i.e., zero-padding).
-        TmpPixelT Window[FILTER_SIZE][FILTER_SIZE];
-        for (int OffsetY = -FilterRadius; OffsetY <= FilterRadius; OffsetY++) {
-            for (int OffsetX = -FilterRadius; OffsetX <= FilterRadius;
-                 OffsetX++) {
-                int y = i + OffsetY, x = j * NPPC + k + OffsetX;
-                bool WindowOutOfBounds =
-                    (y < 0) | (y >= ImgHeight) | (x < 0) | (x >= ImgWidth);
-                // Array indices start from 0 so we need to "recalibrate" the
-                // index by adding `FilterRadius`. E.g., for 3x3 filter, the
-                // offset is from -1 to 1. To turn it into 0-based index, we
-                // need to add FilterRadius = 1.
-                int ArrayIdxY = OffsetY + FilterRadius,
-                    ArrayIdxX = OffsetX + FilterRadius;
-                Window[ArrayIdxY][ArrayIdxX] =
-                    WindowOutOfBounds ? TmpPixelT(0)
-                                      : TmpPixelT(LineBuffer.AccessWindow(
-                                            ArrayIdxY, ArrayIdxX, k));
-            }
-        }
+        // Get the input window from LineBuffer, padded according to BORDER
+        // where it extends outside of the image.
+        ap_uint<InPixelWidth> Window[FILTER_SIZE][FILTER_SIZE];
+        LineBuffer.template GetWindow<BORDER>(Window, i, j, k, ImgHeight,
+                                              ImgWidth);
 
         // Apply the convolution.
         TmpPixelT GxSum = 0, GySum = 0;
@@ -96,7 +78,7 @@ void SobelProcess(
                 int ArrayIdxY = OffsetY + FilterRadius,
                     ArrayIdxX = OffsetX + FilterRadius;
                 // Get the pixel in "receptive field" from LineBuffer's window.
-                auto Pixel = Window[ArrayIdxY][ArrayIdxX];
+                auto Pixel = TmpPixelT(Window[ArrayIdxY][ArrayIdxX]);
                 GxSum += Pixel * KernelX[ArrayIdxY][ArrayIdxX];
                 GySum += Pixel * KernelY[ArrayIdxY][ArrayIdxX];
             }
@@ -176,7 +158,9 @@ void SobelProcess(
 // - Add support for clamp logic. Right now we assume [0, 255] for all pixel
 //   types which is not correct, but we need to be really careful with the clamp
 //   logic since this function can be called both by itself or by Canny().
-template <unsigned FILTER_SIZE = 3, PixelType PIXEL_T_IN, PixelType PIXEL_T_OUT,
+template <unsigned FILTER_SIZE = 3, BorderType BORDER = BORDER_ZERO,
+          LineBufferStorage LB_STORAGE = LINE_BUFFER_DEFAULT,
+          PixelType PIXEL_T_IN, PixelType PIXEL_T_OUT,
           unsigned H, unsigned W, StorageType STORAGE_IN = StorageType::FIFO,
           StorageType STORAGE_OUT = StorageType::FIFO,
           NumPixelsPerCycle NPPC = NPPC_1>
@@ -204,7 +188,8 @@ void Sobel(vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
 
     const unsigned FrameSize = (ImgHeight * ImgWidth) / NPPC;
     const unsigned InPixelWidth = DT<PIXEL_T_IN, NPPC>::W / NPPC;
-    LineBuffer<InPixelWordT, W / NPPC, FILTER_SIZE, InPixelWidth, NPPC>
+    LineBufferWithStorage<InPixelWordT, W / NPPC, FILTER_SIZE, InPixelWidth,
+                          NPPC, LB_STORAGE>
         LineBuffer;
     const unsigned FilterRadius = FILTER_SIZE / 2;
     // Before we can process the first pixel word, the LineBuffer needs to be
@@ -259,8 +244,8 @@ void Sobel(vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
          Count++) {
         auto InPixelWord = InImg.read(Count);
         LineBuffer.ShiftInPixel(InPixelWord);
-        SobelProcess<FILTER_SIZE>(InImg, OutImg, OutDirection, LineBuffer, i,
-                                  j);
+        SobelProcess<FILTER_SIZE, BORDER>(InImg, OutImg, OutDirection,
+                                          LineBuffer, i, j);
     }
 
 // 3. Process only (flush out). The input to LineBuffer is 0.
@@ -268,8 +253,8 @@ void Sobel(vision::Img<PIXEL_T_IN, H, W, STORAGE_IN, NPPC> &InImg,
     for (unsigned Count = FrameSize;
          Count < FrameSize + LineBufferPixelWordFillCount; Count++) {
         LineBuffer.ShiftInPixel(0);
-        SobelProcess<FILTER_SIZE>(InImg, OutImg, OutDirection, LineBuffer, i,
-                                  j);
+        SobelProcess<FILTER_SIZE, BORDER>(InImg, OutImg, OutDirection,
+                                          LineBuffer, i, j);
     }
 }
 
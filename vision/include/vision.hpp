@@ -14,11 +14,14 @@
 #include "./imgproc/image_enhance.hpp"
 #include "./imgproc/format_conversions.hpp"
 #include "./imgproc/gaussian_blur.hpp"
+#include "./imgproc/median_blur.hpp"
+#include "./imgproc/morphology.hpp"
 #include "./imgproc/bilinear_filter.hpp"
 #include "./imgproc/bilateral_filter.hpp"
 #include "./imgproc/hysteresis.hpp"
 #include "./imgproc/histogram.hpp"
 #include "./imgproc/equalized_histogram.hpp"
+#include "./imgproc/clahe.hpp"
 #include "./imgproc/nonmaximum_suppression.hpp"
 #include "./imgproc/sobel.hpp"
 #include "./imgproc/sobel_direction.hpp"
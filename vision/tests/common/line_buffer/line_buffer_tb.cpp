@@ -0,0 +1,179 @@
+// Checks that the LineBuffer storages (see LineBufferStorage) give the same
+// windows, and the filters built on the LineBuffer the same outputs, as the
+// default LineBuffer (LINE_BUFFER_DEFAULT), for NPPC 1, 2 and 4.
+
+#include "vision.hpp"
+#include <opencv2/opencv.hpp>
+#include <string>
+
+using namespace hls;
+using cv::Mat;
+using vision::Img;
+
+#ifdef SMALL_TEST_FRAME
+#define WIDTH 100
+#define HEIGHT 56
+#else
+#define WIDTH 1920
+#define HEIGHT 1080
+#endif
+#define SIZE (WIDTH * HEIGHT)
+
+using ImgT1 = Img<vision::PixelType::HLS_8UC1, HEIGHT, WIDTH,
+                  vision::StorageType::FIFO, vision::NPPC_4>;
+using ImgT3 = Img<vision::PixelType::HLS_8UC3, HEIGHT, WIDTH,
+                  vision::StorageType::FIFO, vision::NPPC_2>;
+
+//
+// Top-level wrapper functions, one per filter and storage.
+//
+template <vision::LineBufferStorage LB_STORAGE>
+void ConvolutionWrapper(ImgT3 &InImg, ImgT3 &OutImg) {
+    #pragma HLS function top
+    vision::Convolution_2d<5, vision::BORDER_REFLECT_101, LB_STORAGE>(
+        InImg, OutImg, vision::GaussianBlurKernel);
+}
+
+template <vision::LineBufferStorage LB_STORAGE>
+void SobelWrapper(ImgT1 &InImg, ImgT1 &OutImg) {
+    #pragma HLS function top
+    vision::Sobel<3, vision::BORDER_REPLICATE, LB_STORAGE>(InImg, OutImg);
+}
+
+template <vision::LineBufferStorage LB_STORAGE>
+void MedianBlurWrapper(ImgT1 &InImg, ImgT1 &OutImg) {
+    #pragma HLS function top
+    vision::MedianBlur<5, vision::BORDER_REPLICATE, LB_STORAGE>(InImg,
+                                                                OutImg);
+}
+
+template <vision::LineBufferStorage LB_STORAGE>
+void MorphologyOpenWrapper(ImgT1 &InImg, ImgT1 &OutImg) {
+    #pragma HLS function top
+    vision::MorphologyOpen<3, vision::BORDER_CONSTANT, LB_STORAGE>(InImg,
+                                                                   OutImg);
+}
+
+//
+// Streams the image through a default LineBuffer and one with LB_STORAGE, and
+// counts the window words that differ once the windows only hold pixels of the
+// image.
+//
+template <unsigned WINDOW_SIZE, unsigned NPPC,
+          vision::LineBufferStorage LB_STORAGE>
+int compareWindows(Mat &InMat) {
+    using WordT = ap_uint<8 * NPPC>;
+    static vision::LineBufferWithStorage<WordT, WIDTH / NPPC, WINDOW_SIZE, 8,
+                                         NPPC, vision::LINE_BUFFER_DEFAULT>
+        Default;
+    static vision::LineBufferWithStorage<WordT, WIDTH / NPPC, WINDOW_SIZE, 8,
+                                         NPPC, LB_STORAGE>
+        LineBuffer;
+    // window[y][x] is the word shifted in (WINDOW_SIZE - 1 - y) rows and
+    // (WINDOW_SIZE - 1 - x) words before the newest one.
+    const unsigned FillCount = (WINDOW_SIZE - 1) * (WIDTH / NPPC + 1);
+
+    int Errors = 0;
+    for (unsigned Count = 0; Count < SIZE / NPPC; Count++) {
+        WordT Word;
+        for (unsigned k = 0; k < NPPC; k++) {
+            unsigned Idx = Count * NPPC + k;
+            Word.byte(k, 8) = InMat.at<unsigned char>(Idx / WIDTH, Idx % WIDTH);
+        }
+        Default.ShiftInPixel(Word);
+        LineBuffer.ShiftInPixel(Word);
+        if (Count < FillCount)
+            continue;
+        for (unsigned y = 0; y < WINDOW_SIZE; y++)
+            for (unsigned x = 0; x < WINDOW_SIZE; x++)
+                Errors += (Default.window[y][x] != LineBuffer.window[y][x]);
+    }
+    if (Errors)
+        printf("  %ux%u window, NPPC %u: %d words differ\n", WINDOW_SIZE,
+               WINDOW_SIZE, NPPC, Errors);
+    return Errors;
+}
+
+int reportDiff(const char *Filter, const char *Storage, Mat &OutMat,
+               Mat &DefaultMat) {
+    float ErrPercent = vision::compareMat(OutMat, DefaultMat, 0);
+    printf("%s, %s: percentage of pixels that differ from "
+           "LINE_BUFFER_DEFAULT: %0.2lf%\n", Filter, Storage, ErrPercent);
+    return (ErrPercent != 0.0);
+}
+
+template <vision::LineBufferStorage LB_STORAGE>
+int testStorage(Mat &InMat, Mat &InMatGray, const char *Storage) {
+    int error = 0;
+
+    int WindowErrors = 0;
+    WindowErrors += compareWindows<3, 1, LB_STORAGE>(InMatGray);
+    WindowErrors += compareWindows<5, 1, LB_STORAGE>(InMatGray);
+    WindowErrors += compareWindows<7, 1, LB_STORAGE>(InMatGray);
+    WindowErrors += compareWindows<3, 2, LB_STORAGE>(InMatGray);
+    WindowErrors += compareWindows<5, 2, LB_STORAGE>(InMatGray);
+    WindowErrors += compareWindows<7, 2, LB_STORAGE>(InMatGray);
+    WindowErrors += compareWindows<3, 4, LB_STORAGE>(InMatGray);
+    WindowErrors += compareWindows<5, 4, LB_STORAGE>(InMatGray);
+    WindowErrors += compareWindows<7, 4, LB_STORAGE>(InMatGray);
+    printf("LineBuffer window, %s: %d words differ from "
+           "LINE_BUFFER_DEFAULT\n", Storage, WindowErrors);
+    error |= (WindowErrors != 0);
+
+    Mat OutMat, DefaultMat;
+    {
+        ImgT3 InImg, OutImg;
+        convertFromCvMat(InMat, InImg);
+        ConvolutionWrapper<vision::LINE_BUFFER_DEFAULT>(InImg, OutImg);
+        convertToCvMat(OutImg, DefaultMat);
+        convertFromCvMat(InMat, InImg);
+        ConvolutionWrapper<LB_STORAGE>(InImg, OutImg);
+        convertToCvMat(OutImg, OutMat);
+        error |= reportDiff("Convolution_2d", Storage, OutMat, DefaultMat);
+    }
+    {
+        ImgT1 InImg, OutImg;
+        convertFromCvMat(InMatGray, InImg);
+        SobelWrapper<vision::LINE_BUFFER_DEFAULT>(InImg, OutImg);
+        convertToCvMat(OutImg, DefaultMat);
+        convertFromCvMat(InMatGray, InImg);
+        SobelWrapper<LB_STORAGE>(InImg, OutImg);
+        convertToCvMat(OutImg, OutMat);
+        error |= reportDiff("Sobel", Storage, OutMat, DefaultMat);
+
+        convertFromCvMat(InMatGray, InImg);
+        MedianBlurWrapper<vision::LINE_BUFFER_DEFAULT>(InImg, OutImg);
+        convertToCvMat(OutImg, DefaultMat);
+        convertFromCvMat(InMatGray, InImg);
+        MedianBlurWrapper<LB_STORAGE>(InImg, OutImg);
+        convertToCvMat(OutImg, OutMat);
+        error |= reportDiff("MedianBlur", Storage, OutMat, DefaultMat);
+
+        convertFromCvMat(InMatGray, InImg);
+        MorphologyOpenWrapper<vision::LINE_BUFFER_DEFAULT>(InImg, OutImg);
+        convertToCvMat(OutImg, DefaultMat);
+        convertFromCvMat(InMatGray, InImg);
+        MorphologyOpenWrapper<LB_STORAGE>(InImg, OutImg);
+        convertToCvMat(OutImg, OutMat);
+        error |= reportDiff("MorphologyOpen", Storage, OutMat, DefaultMat);
+    }
+    return error;
+}
+
+int main(int argc, char* argv[]) {
+    //
+    // Load image from file using OpenCV's imread function
+    //
+    std::string INPUT_IMAGE = argv[1];
+    Mat InMat = cv::imread(INPUT_IMAGE, cv::IMREAD_COLOR);
+    Mat InMatGray = cv::imread(INPUT_IMAGE, cv::IMREAD_GRAYSCALE);
+
+    int error = 0;
+    error |= testStorage<vision::LINE_BUFFER_LOW_RAM>(InMat, InMatGray,
+                                                      "LINE_BUFFER_LOW_RAM");
+    error |= testStorage<vision::LINE_BUFFER_PACKED_ROWS>(
+        InMat, InMatGray, "LINE_BUFFER_PACKED_ROWS");
+
+    printf("%s\n", error ? "FAIL" : "PASS");
+    return error;
+}